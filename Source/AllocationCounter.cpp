@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    AllocationCounter.cpp
+    Created: 18 Oct 2026 8:03:12pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "AllocationCounter.h"
+
+namespace {
+    struct Counts {
+        int64 numAllocations, numBytes;
+    };
+
+    // trivially constructed, so it's safe to use from operator new while a thread is starting
+    thread_local Counts counts{0, 0};
+}
+
+AllocationCounter::AllocationCounter() noexcept {
+    reset();
+}
+
+int64 AllocationCounter::getNumAllocations() const noexcept {
+    return counts.numAllocations - startAllocations;
+}
+
+int64 AllocationCounter::getNumBytesInUse() const noexcept {
+    return counts.numBytes - startBytes;
+}
+
+void AllocationCounter::reset() noexcept {
+    startAllocations = counts.numAllocations;
+    startBytes = counts.numBytes;
+}
+
+//==============================================================================
+#if LISTBOX_COUNT_ALLOCATIONS
+
+namespace {
+    // each block starts with its size, padded so that what follows is still suitably aligned
+    const size_t headerSize = (sizeof(size_t) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    void *allocate(const size_t size) noexcept {
+        auto *block = static_cast<char *>(std::malloc(size + headerSize));
+
+        if (block == nullptr)
+            return nullptr;
+
+        *reinterpret_cast<size_t *>(block) = size;
+        ++counts.numAllocations;
+        counts.numBytes += (int64) size;
+        return block + headerSize;
+    }
+
+    void *allocateOrThrow(const size_t size) {
+        if (auto *p = allocate(size))
+            return p;
+
+        throw std::bad_alloc();
+    }
+
+    void release(void *p) noexcept {
+        if (p == nullptr)
+            return;
+
+        auto *block = static_cast<char *>(p) - headerSize;
+        counts.numBytes -= (int64) *reinterpret_cast<size_t *>(block);
+        std::free(block);
+    }
+}
+
+void *operator new(size_t size) { return allocateOrThrow(size); }
+void *operator new[](size_t size) { return allocateOrThrow(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return allocate(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return allocate(size); }
+
+void operator delete(void *p) noexcept { release(p); }
+void operator delete[](void *p) noexcept { release(p); }
+void operator delete(void *p, size_t) noexcept { release(p); }
+void operator delete[](void *p, size_t) noexcept { release(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { release(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { release(p); }
+
+#endif
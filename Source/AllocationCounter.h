@@ -0,0 +1,60 @@
+/*
+  ==============================================================================
+
+    AllocationCounter.h
+    Created: 18 Oct 2026 8:03:12pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/** Set this to 1 to make the app replace the global operator new and delete, so that
+    AllocationCounter can count allocations. That puts a small cost on every allocation
+    the app makes, so it's only turned on in the project's Benchmark configuration;
+    otherwise AllocationCounter always reports nothing.
+*/
+#ifndef LISTBOX_COUNT_ALLOCATIONS
+ #define LISTBOX_COUNT_ALLOCATIONS 0
+#endif
+
+/**
+    Counts the memory allocated with operator new on the calling thread, so that the
+    benchmarks can report how much memory something uses, and checks can make sure
+    that a piece of code doesn't allocate at all.
+
+    A counter starts counting when it's created. Only the calling thread's allocations
+    are counted, so work that other threads are doing at the same time doesn't get
+    mixed in; memory that's freed on a different thread from the one that allocated it
+    is taken off that thread's count.
+
+    @code
+    AllocationCounter counter;
+    list.setSize(500, 100);
+    jassert(counter.getNumAllocations() == 0);
+    @endcode
+*/
+class AllocationCounter {
+public:
+    AllocationCounter() noexcept;
+
+    /** Returns true if allocations are being counted at all. */
+    static constexpr bool isEnabled() noexcept { return LISTBOX_COUNT_ALLOCATIONS != 0; }
+
+    /** Returns the number of allocations made since the counter was created. */
+    int64 getNumAllocations() const noexcept;
+
+    /** Returns the number of bytes allocated since the counter was created, less the
+        number freed. This can be negative if more was freed than allocated.
+    */
+    int64 getNumBytesInUse() const noexcept;
+
+    /** Starts counting again from zero. */
+    void reset() noexcept;
+
+private:
+    int64 startAllocations, startBytes;
+};
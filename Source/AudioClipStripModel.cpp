@@ -0,0 +1,303 @@
+/*
+  ==============================================================================
+
+    AudioClipStripModel.cpp
+    Created: 18 Oct 2026 7:18:58pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "AudioClipStripModel.h"
+
+namespace {
+    const char peaksMagic[] = "HLPK";
+    const int peaksVersion = 1;
+    const int maxPeakChannels = 2;
+    const int scanBlockSize = 32768;
+}
+
+//==============================================================================
+Range<float> AudioClipPeaks::getRange(const int channel, const Range<int> buckets) const noexcept {
+    const auto r = buckets.getIntersectionWith({0, numBuckets});
+
+    if (r.isEmpty())
+        return {};
+
+    auto *v = values.data() + (size_t) (channel * numBuckets + r.getStart()) * 2;
+    auto low = v[0], high = v[1];
+
+    for (auto i = 1; i < r.getLength(); ++i) {
+        low = jmin(low, v[i * 2]);
+        high = jmax(high, v[i * 2 + 1]);
+    }
+
+    return {low, high};
+}
+
+//==============================================================================
+AudioClipStripModel::AudioClipStripModel() : FileStripModel(16 * 1024 * 1024) {
+    formatManager.registerBasicFormats();
+}
+
+AudioClipStripModel::~AudioClipStripModel() {
+    shouldStop = true;
+    stopLoading();
+}
+
+void AudioClipStripModel::setDiskCacheDirectory(const File &directory) {
+    if (directory != File())
+        directory.createDirectory();
+
+    const SpinLock::ScopedLockType sl(diskCacheLock);
+    diskCacheDirectory = directory;
+}
+
+File AudioClipStripModel::getDiskCacheDirectory() const {
+    const SpinLock::ScopedLockType sl(diskCacheLock);
+    return diskCacheDirectory;
+}
+
+void AudioClipStripModel::setWaveformMargin(const int newMargin) {
+    margin = jmax(0, newMargin);
+
+    if (listBox != nullptr)
+        listBox->repaint();
+}
+
+//==============================================================================
+void AudioClipStripModel::paintListBoxItemWithDetail(const int rowNumber, Graphics &g, const int width,
+                                                     const int height, const bool rowIsSelected,
+                                                     const DetailLevel detail) {
+    auto &lf = LookAndFeel::getDefaultLookAndFeel();
+    const auto file = getFile(rowNumber);
+    const auto area = Rectangle<int>(width, height).reduced(margin);
+    const auto peaks = findItem(rowNumber, file);
+
+    g.setColour(lf.findColour(ListBox::backgroundColourId).contrasting(0.1f));
+    g.fillRect(area);
+
+    if (peaks != nullptr && peaks->numBuckets > 0) {
+        g.setColour(lf.findColour(ListBox::textColourId).withMultipliedAlpha(0.8f));
+        drawWaveform(g, *peaks, area, detail == DetailLevel::reduced ? 4 : 1);
+    }
+
+    if (detail == DetailLevel::full) {
+        g.setColour(lf.findColour(ListBox::textColourId).withMultipliedAlpha(0.6f));
+        drawCachedText(g, file.getFileName(), Font(jlimit(10.0f, 14.0f, height * 0.1f)),
+                       area.reduced(4).removeFromTop(20), Justification::centredLeft);
+    }
+
+    if (rowIsSelected) {
+        g.setColour(lf.findColour(TextEditor::highlightColourId));
+        g.drawRect(0, 0, width, height, jmax(2, margin / 2));
+    }
+}
+
+//==============================================================================
+int AudioClipStripModel::getTargetFor(const int colWidth, const int) const {
+    // one bucket per physical pixel, rounded up to a power of two so that small
+    // changes in the column width can still use the peaks that are already cached
+    const auto scale = Desktop::getInstance().getDisplays().getMainDisplay().scale;
+
+    return nextPowerOfTwo(jmax(64, roundToInt(jmax(1, colWidth - margin * 2) * scale)));
+}
+
+bool AudioClipStripModel::isGoodEnoughFor(const AudioClipPeaks &peaks, const int &numBuckets) const {
+    // peaks with more detail than we need are fine, they're just reduced further when drawn
+    return peaks.requestedBuckets >= numBuckets;
+}
+
+// A file that can't be read still gets peaks (with no buckets), so it isn't retried on
+// every paint. Only a scan that was stopped part way returns nullptr.
+AudioClipStripModel::ItemPtr AudioClipStripModel::loadItem(const File &file, const int &numBuckets) {
+    const auto directory = getDiskCacheDirectory();
+
+    if (directory == File())
+        return scanFile(file, numBuckets);
+
+    const auto key = getDiskCacheKey(file, numBuckets);
+    const auto cacheFile = getDiskCacheFile(directory, key);
+
+    if (auto peaks = readPeaks(cacheFile, key))
+        return peaks;
+
+    auto peaks = scanFile(file, numBuckets);
+
+    if (peaks != nullptr && peaks->numBuckets > 0)
+        writePeaks(cacheFile, key, *peaks);
+
+    return peaks;
+}
+
+AudioClipStripModel::ItemPtr AudioClipStripModel::scanFile(const File &file, const int numBuckets) {
+    auto peaks = std::make_shared<AudioClipPeaks>();
+    peaks->requestedBuckets = numBuckets;
+
+    std::unique_ptr<AudioFormatReader> reader(formatManager.createReaderFor(file));
+
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->numChannels == 0 || reader->sampleRate <= 0)
+        return peaks;
+
+    const auto length = reader->lengthInSamples;
+    const auto numChannels = jmin(maxPeakChannels, (int) reader->numChannels);
+
+    // a very short file can't fill every bucket, so it gets one per sample instead
+    const auto n = (int) jmin((int64) numBuckets, length);
+    std::vector<float> values((size_t) (numChannels * n * 2));
+
+    AudioBuffer<float> buffer(numChannels, scanBlockSize);
+    float low[maxPeakChannels], high[maxPeakChannels];
+    auto bucket = 0;
+    auto bucketEnd = length / n;
+    auto bucketStarted = false;
+
+    // the file is read in big blocks, and each block is split at the bucket edges,
+    // so the min/max search runs over long runs of samples whatever the bucket size
+    for (int64 pos = 0; pos < length; pos += scanBlockSize) {
+        if (shouldStop)
+            return {};
+
+        const auto numInBlock = (int) jmin((int64) scanBlockSize, length - pos);
+        reader->read(&buffer, 0, numInBlock, pos, true, true);
+
+        for (auto offset = 0; offset < numInBlock;) {
+            const auto end = (int) jmin((int64) numInBlock, bucketEnd - pos);
+
+            for (auto ch = 0; ch < numChannels; ++ch) {
+                const auto r = FloatVectorOperations::findMinAndMax(buffer.getReadPointer(ch, offset), end - offset);
+                low[ch] = bucketStarted ? jmin(low[ch], r.getStart()) : r.getStart();
+                high[ch] = bucketStarted ? jmax(high[ch], r.getEnd()) : r.getEnd();
+            }
+
+            bucketStarted = true;
+            offset = end;
+
+            if (pos + offset == bucketEnd) {
+                for (auto ch = 0; ch < numChannels; ++ch) {
+                    values[(size_t) (ch * n + bucket) * 2] = low[ch];
+                    values[(size_t) (ch * n + bucket) * 2 + 1] = high[ch];
+                }
+
+                bucketStarted = false;
+
+                if (++bucket < n)
+                    bucketEnd = length * (bucket + 1) / n;
+            }
+        }
+    }
+
+    peaks->numChannels = numChannels;
+    peaks->numBuckets = n;
+    peaks->lengthInSeconds = length / reader->sampleRate;
+    peaks->values = std::move(values);
+    return peaks;
+}
+
+//==============================================================================
+String AudioClipStripModel::getDiskCacheKey(const File &file, const int numBuckets) {
+    return file.getFullPathName()
+           + "|" + String(file.getSize())
+           + "|" + String(file.getLastModificationTime().toMilliseconds())
+           + "|" + String(numBuckets);
+}
+
+File AudioClipStripModel::getDiskCacheFile(const File &directory, const String &key) {
+    return directory.getChildFile(String::toHexString(key.hashCode64())).withFileExtension("peaks");
+}
+
+AudioClipStripModel::ItemPtr AudioClipStripModel::readPeaks(const File &cacheFile, const String &key) {
+    FileInputStream in(cacheFile);
+
+    if (in.failedToOpen())
+        return {};
+
+    char magic[4];
+
+    // the whole key is stored, so that a hash collision (or a changed file) is a miss
+    if (in.read(magic, 4) != 4 || memcmp(magic, peaksMagic, 4) != 0
+        || in.readInt() != peaksVersion
+        || in.readString() != key)
+        return {};
+
+    auto peaks = std::make_shared<AudioClipPeaks>();
+    peaks->numChannels = in.readInt();
+    peaks->numBuckets = in.readInt();
+    peaks->requestedBuckets = in.readInt();
+    peaks->lengthInSeconds = in.readDouble();
+
+    if (!isPositiveAndNotGreaterThan(peaks->numChannels, maxPeakChannels)
+        || !isPositiveAndNotGreaterThan(peaks->numBuckets, peaks->requestedBuckets)
+        || peaks->numChannels == 0 || peaks->numBuckets == 0)
+        return {};
+
+    const auto numValues = (size_t) (peaks->numChannels * peaks->numBuckets * 2);
+
+    if (in.getNumBytesRemaining() < (int64) (numValues * sizeof(float)))
+        return {};
+
+    peaks->values.resize(numValues);
+
+    for (auto &v : peaks->values)
+        v = in.readFloat();
+
+    return peaks;
+}
+
+void AudioClipStripModel::writePeaks(const File &cacheFile, const String &key, const AudioClipPeaks &peaks) {
+    TemporaryFile temp(cacheFile);
+
+    {
+        FileOutputStream out(temp.getFile());
+
+        if (out.failedToOpen())
+            return;
+
+        out.write(peaksMagic, 4);
+        out.writeInt(peaksVersion);
+        out.writeString(key);
+        out.writeInt(peaks.numChannels);
+        out.writeInt(peaks.numBuckets);
+        out.writeInt(peaks.requestedBuckets);
+        out.writeDouble(peaks.lengthInSeconds);
+
+        for (auto v : peaks.values)
+            out.writeFloat(v);
+
+        out.flush();
+
+        if (out.getStatus().failed())
+            return;
+    }
+
+    temp.overwriteTargetFileWithTemporary();
+}
+
+//==============================================================================
+void AudioClipStripModel::drawWaveform(Graphics &g, const AudioClipPeaks &peaks, const Rectangle<int> area,
+                                       const int pixelStep) const {
+    const auto w = area.getWidth();
+    const auto channelHeight = area.getHeight() / (float) peaks.numChannels;
+    RectangleList<float> bars;
+
+    bars.ensureStorageAllocated(w / pixelStep * peaks.numChannels + 1);
+
+    for (auto ch = 0; ch < peaks.numChannels; ++ch) {
+        const auto halfHeight = channelHeight * 0.5f;
+        const auto centreY = area.getY() + ch * channelHeight + halfHeight;
+
+        for (auto x = 0; x < w; x += pixelStep) {
+            const auto first = (int) ((int64) x * peaks.numBuckets / w);
+            const auto last = (int) ((int64) (x + pixelStep) * peaks.numBuckets / w);
+            const auto r = peaks.getRange(ch, {first, jmax(first + 1, last)});
+            const auto top = jlimit(-1.0f, 1.0f, r.getEnd());
+            const auto bottom = jlimit(-1.0f, 1.0f, r.getStart());
+
+            // even silence gets a 1px line, so you can see where the clip is
+            bars.addWithoutMerging({(float) (area.getX() + x), centreY - top * halfHeight,
+                                    (float) pixelStep, jmax(1.0f, (top - bottom) * halfHeight)});
+        }
+    }
+
+    g.fillRectList(bars);
+}
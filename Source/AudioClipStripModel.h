@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    AudioClipStripModel.h
+    Created: 18 Oct 2026 7:18:58pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "FileStripModel.h"
+
+/**
+    The peaks an AudioClipStripModel draws a clip from: the min and max of each bucket,
+    for each channel, stored as values[(channel * numBuckets + bucket) * 2] = min, and
+    max just after it.
+*/
+struct AudioClipPeaks {
+    int numChannels = 0, numBuckets = 0;
+    int requestedBuckets = 0; // what it was made for, which is more than numBuckets for very short files
+    double lengthInSeconds = 0;
+    std::vector<float> values;
+
+    Range<float> getRange(int channel, Range<int> buckets) const noexcept;
+
+    int64 getSizeInBytes() const noexcept { return (int64) (values.size() * sizeof(float)); }
+};
+
+/**
+    A model that shows a strip of audio files as waveform thumbnails.
+
+    A clip's peaks (the minimum and maximum sample of each short stretch of audio, per
+    channel) are worked out on the ListWorkerPool, and a clip whose peaks aren't ready
+    yet paints a placeholder.
+
+    Peaks are kept in a memory cache with a limit on the number of bytes it uses, which
+    is 16MB by default, and can also be saved to a directory with setDiskCacheDirectory(),
+    so that files only need to be scanned once. The saved peaks are matched to the
+    file's size and modification time, so a changed file is scanned again. Nothing is
+    ever deleted from the directory - that's up to the app.
+
+    @see FileStripModel
+*/
+class AudioClipStripModel : public FileStripModel<AudioClipPeaks, int> {
+public:
+    AudioClipStripModel();
+
+    ~AudioClipStripModel() override;
+
+    /** Returns the format manager used to open the files, so more formats can be
+        registered. The basic formats are registered already. Don't change it while
+        there are clips in the strip.
+    */
+    AudioFormatManager &getFormatManager() noexcept { return formatManager; }
+
+    //==============================================================================
+    /** Sets a directory to save peaks in, or File() to only keep them in memory
+        (which is the default). The directory is created if it doesn't exist.
+    */
+    void setDiskCacheDirectory(const File &directory);
+
+    /** Returns the directory set with setDiskCacheDirectory(). */
+    File getDiskCacheDirectory() const;
+
+    /** Sets the gap left around each waveform, in pixels. */
+    void setWaveformMargin(int newMargin);
+
+    //==============================================================================
+    /** @internal */
+    void paintListBoxItemWithDetail(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected,
+                                    DetailLevel detail) override;
+
+private:
+    //==============================================================================
+    AudioFormatManager formatManager;
+    int margin = 4;
+
+    mutable SpinLock diskCacheLock;
+    File diskCacheDirectory;
+
+    // set when the model's being deleted, so that long scans give up early
+    std::atomic<bool> shouldStop{false};
+
+    int getTargetFor(int colWidth, int colHeight) const override;
+
+    bool isGoodEnoughFor(const AudioClipPeaks &peaks, const int &numBuckets) const override;
+
+    ItemPtr loadItem(const File &file, const int &numBuckets) override;
+
+    ItemPtr scanFile(const File &file, int numBuckets);
+
+    static File getDiskCacheFile(const File &directory, const String &key);
+
+    static String getDiskCacheKey(const File &file, int numBuckets);
+
+    static ItemPtr readPeaks(const File &cacheFile, const String &key);
+
+    static void writePeaks(const File &cacheFile, const String &key, const AudioClipPeaks &peaks);
+
+    void drawWaveform(Graphics &g, const AudioClipPeaks &peaks, Rectangle<int> area, int pixelStep) const;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioClipStripModel)
+};
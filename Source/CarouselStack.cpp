@@ -0,0 +1,188 @@
+/*
+  ==============================================================================
+
+    CarouselStack.cpp
+    Created: 18 Oct 2026 7:32:44pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "CarouselStack.h"
+
+//==============================================================================
+class CarouselStack::StackViewport : public Viewport {
+public:
+    StackViewport(CarouselStack &s) : owner(s) {
+        setScrollBarsShown(true, false);
+        setViewedComponent(new Component());
+    }
+
+    void visibleAreaChanged(const Rectangle<int> &) override {
+        owner.updateRows();
+    }
+
+private:
+    CarouselStack &owner;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StackViewport)
+};
+
+//==============================================================================
+CarouselStack::CarouselStack(const String &name, CarouselStackModel *const m)
+        : Component(name), model(m) {
+    viewport.reset(new StackViewport(*this));
+    addAndMakeVisible(viewport.get());
+    updateContent();
+}
+
+CarouselStack::~CarouselStack() {
+    // the lists are children of the viewport's content, so they have to go first
+    liveLists.clear();
+    spareLists.clear();
+    viewport.reset();
+}
+
+void CarouselStack::setModel(CarouselStackModel *const newModel) {
+    if (model != newModel) {
+        releaseAllRows();
+        model = newModel;
+        rowPositions.clear();
+        updateContent();
+    }
+}
+
+void CarouselStack::updateContent() {
+    // the rows' models may have changed, so every list has to be set up again, and as the
+    // old models may have been deleted, a new one could have the same address as one that
+    // has images in the cache
+    releaseAllRows();
+    renderCache.clear();
+
+    numRows = model != nullptr ? jmax(0, model->getNumRows()) : 0;
+    rowPositions.resize((size_t) numRows, 0.0);
+
+    resized();
+}
+
+//==============================================================================
+void CarouselStack::setRowHeight(const int newHeight) {
+    if (rowHeight != newHeight) {
+        rowHeight = jmax(1, newHeight);
+        resized();
+    }
+}
+
+HorizontalListBox *CarouselStack::getListForRow(const int row) const noexcept {
+    return liveRows.contains(row) ? liveLists[row - liveRows.getStart()] : nullptr;
+}
+
+void CarouselStack::setRowScrollPositionX(const int row, const double newX) {
+    if (auto *list = getListForRow(row))
+        list->setScrollPositionX(newX);
+    else if (isPositiveAndBelow(row, numRows))
+        rowPositions[(size_t) row] = newX;
+}
+
+double CarouselStack::getRowScrollPositionX(const int row) const noexcept {
+    if (auto *list = getListForRow(row))
+        return list->getScrollPositionX();
+
+    return isPositiveAndBelow(row, numRows) ? rowPositions[(size_t) row] : 0.0;
+}
+
+void CarouselStack::scrollToEnsureRowIsOnscreen(const int row) {
+    const auto top = row * rowHeight;
+    auto y = viewport->getViewPositionY();
+
+    if (top < y)
+        y = top;
+    else if (top + rowHeight > y + viewport->getViewHeight())
+        y = top + rowHeight - viewport->getViewHeight();
+
+    viewport->setViewPosition(0, jmax(0, y));
+}
+
+Viewport &CarouselStack::getViewport() noexcept {
+    return *viewport;
+}
+
+void CarouselStack::resized() {
+    viewport->setBounds(getLocalBounds());
+
+    auto &content = *viewport->getViewedComponent();
+    content.setSize(viewport->getMaximumVisibleWidth(), numRows * rowHeight);
+
+    for (int i = 0; i < liveLists.size(); ++i)
+        liveLists.getUnchecked(i)->setBounds(0, (liveRows.getStart() + i) * rowHeight, content.getWidth(), rowHeight);
+
+    updateRows();
+}
+
+//==============================================================================
+void CarouselStack::updateRows() {
+    const auto y = viewport->getViewPositionY();
+    const auto visibleRows = Range<int>(y / rowHeight, (y + viewport->getMaximumVisibleHeight() + rowHeight - 1) / rowHeight)
+            .getIntersectionWith({0, numRows});
+
+    if (visibleRows == liveRows)
+        return;
+
+    for (int i = liveLists.size(); --i >= 0;) {
+        const auto row = liveRows.getStart() + i;
+
+        if (!visibleRows.contains(row))
+            releaseList(row, liveLists.removeAndReturn(i));
+    }
+
+    // the rows that are still on screen are contiguous, so the new ones go either side
+    auto keptRows = liveRows.getIntersectionWith(visibleRows);
+
+    if (keptRows.isEmpty())
+        keptRows = Range<int>::emptyRange(visibleRows.getStart());
+
+    for (int row = keptRows.getStart(); --row >= visibleRows.getStart();)
+        liveLists.insert(0, obtainList(row));
+
+    for (int row = keptRows.getEnd(); row < visibleRows.getEnd(); ++row)
+        liveLists.add(obtainList(row));
+
+    liveRows = visibleRows;
+}
+
+void CarouselStack::releaseAllRows() {
+    for (int i = liveLists.size(); --i >= 0;)
+        releaseList(liveRows.getStart() + i, liveLists.removeAndReturn(i));
+
+    liveRows = {};
+}
+
+HorizontalListBox *CarouselStack::obtainList(const int row) {
+    auto *list = spareLists.isEmpty() ? new HorizontalListBox()
+                                      : spareLists.removeAndReturn(spareLists.size() - 1);
+
+    list->setBounds(0, row * rowHeight, viewport->getViewedComponent()->getWidth(), rowHeight);
+    viewport->getViewedComponent()->addAndMakeVisible(list);
+
+    list->setRenderCache(&renderCache);
+    model->listWillShowRow(row, *list);
+    list->setModel(model->getModelForRow(row));
+    list->setScrollPositionX(rowPositions[(size_t) row]);
+    return list;
+}
+
+void CarouselStack::releaseList(const int row, HorizontalListBox *const list) {
+    if (isPositiveAndBelow(row, (int) rowPositions.size()))
+        rowPositions[(size_t) row] = list->getScrollPositionX();
+
+    if (spareLists.size() >= maxSpareLists) {
+        delete list;
+        return;
+    }
+
+    // a spare doesn't keep anything of the row it was showing
+    list->setVisible(false);
+    list->deselectAllCols();
+    list->setModel(nullptr);
+    spareLists.add(list);
+}
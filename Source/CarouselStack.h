@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+    CarouselStack.h
+    Created: 18 Oct 2026 7:32:44pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBox.h"
+#include "ItemRenderCache.h"
+
+/**
+    Provides the rows of a CarouselStack.
+*/
+class CarouselStackModel {
+public:
+    virtual ~CarouselStackModel() = default;
+
+    /** Returns the number of rows in the stack. */
+    virtual int getNumRows() = 0;
+
+    /** Returns the model for one row's list. It isn't owned by the stack, and it has to
+        stay valid until the row goes off screen or updateContent() is called.
+    */
+    virtual ListBoxModel *getModelForRow(int row) = 0;
+
+    /** Called when a list is about to be shown as a row, so that it can be set up for it
+        (column width, tail following, etc.). The list may have been used for another row
+        before, so anything that differs between rows should be set every time.
+    */
+    virtual void listWillShowRow(int row, HorizontalListBox &list) { ignoreUnused(row, list); }
+};
+
+//==============================================================================
+/**
+    A vertically scrolling stack of HorizontalListBoxes, e.g. a home screen made of
+    rows of carousels.
+
+    Only the rows that are on screen have a list. When a row scrolls out of view, its
+    scroll position is remembered and its list is handed to the next row that scrolls
+    into view, along with the list's column components, so a stack of any number of
+    rows only ever has a screenful of lists. All the rows share one ItemRenderCache,
+    so a row that scrolls back into view is drawn from the images cached while it was
+    last on screen, and the lists' background work already shares the ListWorkerPool.
+
+    A row's selection isn't kept when it goes off screen.
+*/
+class CarouselStack : public Component {
+public:
+    CarouselStack(const String &componentName = String(), CarouselStackModel *model = nullptr);
+
+    ~CarouselStack() override;
+
+    //==============================================================================
+    /** Changes the model that provides the rows, and calls updateContent(). */
+    void setModel(CarouselStackModel *newModel);
+
+    /** Returns the current model. */
+    CarouselStackModel *getModel() const noexcept { return model; }
+
+    /** Asks the model for the rows again, e.g. because some have been added or removed.
+        The rows keep their scroll positions.
+    */
+    void updateContent();
+
+    //==============================================================================
+    /** Sets the height of every row. The default is 120 pixels. */
+    void setRowHeight(int newHeight);
+
+    /** Returns the height of each row. */
+    int getRowHeight() const noexcept { return rowHeight; }
+
+    /** Returns the list that's showing a row, or nullptr if the row isn't on screen. */
+    HorizontalListBox *getListForRow(int row) const noexcept;
+
+    /** Scrolls a row horizontally, whether or not it's on screen. */
+    void setRowScrollPositionX(int row, double newX);
+
+    /** Returns a row's horizontal scroll position. */
+    double getRowScrollPositionX(int row) const noexcept;
+
+    /** Scrolls the stack vertically so that a row is in view. */
+    void scrollToEnsureRowIsOnscreen(int row);
+
+    /** Returns the viewport that scrolls the stack vertically. */
+    Viewport &getViewport() noexcept;
+
+    /** Returns the render cache that all the rows share. */
+    ItemRenderCache &getRenderCache() noexcept { return renderCache; }
+
+    //==============================================================================
+    /** @internal */
+    void resized() override;
+
+private:
+    //==============================================================================
+    JUCE_PUBLIC_IN_DLL_BUILD (class StackViewport)
+
+    // a few lists are kept when the stack gets shorter, rather than deleted
+    static constexpr int maxSpareLists = 4;
+
+    CarouselStackModel *model;
+    std::unique_ptr<StackViewport> viewport;
+    ItemRenderCache renderCache;
+    OwnedArray<HorizontalListBox> liveLists, spareLists; // liveLists[i] shows row liveRows.getStart() + i
+    Range<int> liveRows;
+    std::vector<double> rowPositions;
+    int numRows = 0, rowHeight = 120;
+
+    void updateRows();
+
+    void releaseAllRows();
+
+    HorizontalListBox *obtainList(int row);
+
+    void releaseList(int row, HorizontalListBox *list);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CarouselStack)
+};
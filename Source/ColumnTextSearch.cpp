@@ -0,0 +1,306 @@
+/*
+  ==============================================================================
+
+    ColumnTextSearch.cpp
+    Created: 18 Oct 2026 7:01:47pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ColumnTextSearch.h"
+
+namespace {
+    const int searchChunkSize = 2048;
+}
+
+//==============================================================================
+// Shared between the search and the jobs it has queued, because a job may only get
+// round to running after the search has been deleted.
+struct ColumnTextSearch::WorkerState {
+    WorkerState() { noActiveWorkers.signal(); }
+
+    CriticalSection lock;
+    ColumnTextSearch *owner = nullptr;
+    int numActiveWorkers = 0;
+    WaitableEvent noActiveWorkers{true}; // signalled whenever numActiveWorkers is 0
+};
+
+struct ColumnTextSearch::Scan {
+    Scan(const String &t, bool ic, TextSource s) : text(t), ignoreCase(ic), source(std::move(s)) {}
+
+    bool isFinished() const noexcept { return chunksDone.load() == chunks.size(); }
+
+    void scanChunk(Range<int> chunk) {
+        Array<Range<int>> runs;
+        auto runStart = -1;
+
+        for (auto col = chunk.getStart(); col < chunk.getEnd(); ++col) {
+            // getting a column's text may be slow, so don't keep the search's owner
+            // waiting for the rest of the chunk once it's been cancelled
+            if (cancelled)
+                return;
+
+            auto colText = source(col);
+
+            if (ignoreCase ? colText.containsIgnoreCase(text) : colText.contains(text)) {
+                if (runStart < 0)
+                    runStart = col;
+            } else if (runStart >= 0) {
+                runs.add({runStart, col});
+                runStart = -1;
+            }
+        }
+
+        if (runStart >= 0)
+            runs.add({runStart, chunk.getEnd()});
+
+        const ScopedLock sl(foundLock);
+
+        for (auto &r : runs)
+            found.addRange(r);
+    }
+
+    static void runWorker(std::shared_ptr<WorkerState> state, std::shared_ptr<Scan> scan) {
+        ColumnTextSearch *owner = nullptr;
+
+        {
+            const ScopedLock sl(state->lock);
+
+            if (state->owner == nullptr || scan->cancelled)
+                return;
+
+            owner = state->owner;
+
+            if (state->numActiveWorkers++ == 0)
+                state->noActiveWorkers.reset();
+        }
+
+        while (!scan->cancelled) {
+            const auto chunk = scan->nextChunk++;
+
+            if (chunk >= scan->chunks.size())
+                break;
+
+            scan->scanChunk(scan->chunks.getUnchecked(chunk));
+            ++scan->chunksDone;
+            owner->triggerAsyncUpdate();
+        }
+
+        const ScopedLock sl(state->lock);
+
+        if (--state->numActiveWorkers == 0)
+            state->noActiveWorkers.signal();
+    }
+
+    const String text;
+    const bool ignoreCase;
+    const TextSource source;
+    Array<Range<int>> chunks;
+    std::atomic<int> nextChunk{0}, chunksDone{0};
+    std::atomic<bool> cancelled{false};
+
+    CriticalSection foundLock;
+    IntervalSet found;
+};
+
+//==============================================================================
+ColumnTextSearch::ColumnTextSearch() : workerState(std::make_shared<WorkerState>()) {
+    workerState->owner = this;
+}
+
+ColumnTextSearch::~ColumnTextSearch() {
+    cancelScans();
+
+    {
+        const ScopedLock sl(workerState->lock);
+        workerState->owner = nullptr;
+    }
+
+    // a worker that's part-way through a chunk will still call triggerAsyncUpdate()
+    // when it stops, so we have to wait for it before going away. Workers check for
+    // cancellation between columns, so this only waits for one getTextForCol() call.
+    workerState->noActiveWorkers.wait();
+
+    cancelPendingUpdate();
+}
+
+void ColumnTextSearch::start(const String &textToFind, const bool ignoreCase, const int numCols,
+                             TextSource textSource) {
+    // if the new text contains the old text, only columns that matched before can match now
+    const bool canRefine = lastSearchCompleted
+                           && searchIgnoresCase == ignoreCase
+                           && numColsSearched == numCols
+                           && searchText.isNotEmpty()
+                           && (ignoreCase ? textToFind.containsIgnoreCase(searchText)
+                                          : textToFind.contains(searchText));
+
+    Array<Range<int>> colsToScan;
+
+    if (canRefine) {
+        for (auto &r : matches)
+            colsToScan.add(r);
+    } else {
+        colsToScan.add({0, numCols});
+    }
+
+    cancelScans();
+    matches.clear();
+
+    searchText = textToFind;
+    searchIgnoresCase = ignoreCase;
+    numColsSearched = numCols;
+    source = std::move(textSource);
+
+    launchScan(colsToScan);
+}
+
+void ColumnTextSearch::restart(const int numCols) {
+    if (searchText.isNotEmpty() && source != nullptr) {
+        cancelScans();
+        matches.clear();
+        numColsSearched = numCols;
+
+        Array<Range<int>> colsToScan;
+        colsToScan.add({0, numCols});
+        launchScan(colsToScan);
+    }
+}
+
+void ColumnTextSearch::scanMore(Range<int> cols) {
+    if (searchText.isNotEmpty() && source != nullptr) {
+        numColsSearched = jmax(numColsSearched, cols.getEnd());
+
+        Array<Range<int>> colsToScan;
+        colsToScan.add(cols);
+        launchScan(colsToScan);
+    }
+}
+
+void ColumnTextSearch::trimToSize(const int numCols) {
+    numColsSearched = jmin(numColsSearched, numCols);
+    matches.removeRange({numCols, std::numeric_limits<int>::max()});
+}
+
+void ColumnTextSearch::removeCols(const Range<int> cols) {
+    replaceCols(cols, cols.withLength(0));
+}
+
+void ColumnTextSearch::insertCols(const Range<int> cols) {
+    replaceCols(cols.withLength(0), cols);
+}
+
+void ColumnTextSearch::replaceCols(const Range<int> oldCols, const Range<int> newCols) {
+    if (searchText.isEmpty() || source == nullptr || (oldCols.isEmpty() && newCols.isEmpty()))
+        return;
+
+    const auto numRemoved = oldCols.getIntersectionWith({0, numColsSearched}).getLength();
+    const auto numInserted = newCols.getStart() <= numColsSearched - numRemoved ? newCols.getLength() : 0;
+
+    if (numRemoved == 0 && numInserted == 0)
+        return;
+
+    if (!activeScans.empty()) {
+        restart(numColsSearched - numRemoved + numInserted);
+        return;
+    }
+
+    matches.removeAndShift(oldCols);
+    numColsSearched -= numRemoved;
+
+    if (numInserted > 0) {
+        matches.insertAndShift(newCols);
+        numColsSearched += numInserted;
+
+        Array<Range<int>> colsToScan;
+        colsToScan.add(newCols);
+        launchScan(colsToScan);
+    }
+}
+
+void ColumnTextSearch::rescanCols(Range<int> cols) {
+    cols = cols.getIntersectionWith({0, numColsSearched});
+
+    if (searchText.isEmpty() || source == nullptr || cols.isEmpty())
+        return;
+
+    matches.removeRange(cols);
+
+    Array<Range<int>> colsToScan;
+    colsToScan.add(cols);
+    launchScan(colsToScan);
+}
+
+void ColumnTextSearch::clear() {
+    cancelScans();
+    matches.clear();
+    searchText.clear();
+    source = nullptr;
+    numColsSearched = 0;
+    lastSearchCompleted = false;
+}
+
+//==============================================================================
+void ColumnTextSearch::launchScan(const Array<Range<int>> &colsToScan) {
+    auto scan = std::make_shared<Scan>(searchText, searchIgnoresCase, source);
+
+    for (auto &r : colsToScan)
+        for (auto start = r.getStart(); start < r.getEnd(); start += jmin(searchChunkSize, r.getEnd() - start))
+            scan->chunks.add({start, jmin(r.getEnd(), start + searchChunkSize)});
+
+    lastSearchCompleted = false;
+
+    if (scan->chunks.isEmpty()) {
+        triggerAsyncUpdate();
+        return;
+    }
+
+    activeScans.push_back(scan);
+
+    for (int i = jmin(pool->getNumThreads(), scan->chunks.size()); --i >= 0;)
+        pool->addJob([state = workerState, scan] { Scan::runWorker(state, scan); });
+}
+
+void ColumnTextSearch::cancelScans() {
+    for (auto &scan : activeScans)
+        scan->cancelled = true;
+
+    activeScans.clear();
+}
+
+void ColumnTextSearch::handleAsyncUpdate() {
+    IntervalSet newMatches;
+
+    for (auto i = activeScans.size(); i-- > 0;) {
+        auto &scan = *activeScans[i];
+
+        // this has to be checked before taking the results, so that a chunk that
+        // finishes in between doesn't get its matches left behind
+        const bool finished = scan.isFinished();
+
+        {
+            const ScopedLock sl(scan.foundLock);
+            newMatches.addSet(scan.found);
+            scan.found.clear();
+        }
+
+        if (finished)
+            activeScans.erase(activeScans.begin() + (int) i);
+    }
+
+    newMatches.removeRange({numColsSearched, std::numeric_limits<int>::max()});
+
+    if (!newMatches.isEmpty()) {
+        matches.addSet(newMatches);
+
+        if (onMatchesFound != nullptr)
+            onMatchesFound(newMatches);
+    }
+
+    if (activeScans.empty() && !lastSearchCompleted && searchText.isNotEmpty()) {
+        lastSearchCompleted = true;
+
+        if (onSearchFinished != nullptr)
+            onSearchFinished();
+    }
+}
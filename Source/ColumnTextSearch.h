@@ -0,0 +1,122 @@
+/*
+  ==============================================================================
+
+    ColumnTextSearch.h
+    Created: 18 Oct 2026 7:01:47pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "IntervalSet.h"
+#include "ListWorkerPool.h"
+
+/**
+    Searches the text of a list's columns on the ListWorkerPool.
+
+    The columns are split into chunks which the pool's threads work through, and the
+    matches from each chunk are passed back to the message thread as they're found, so
+    the caller can show them while the rest of the list is still being scanned.
+
+    Starting a new search cancels the running one. If the new text contains the previous
+    text and the previous search had finished, only the columns that matched last time
+    are checked again, which is what makes type-ahead cheap.
+
+    HorizontalListBox uses this for findText() and type-ahead; all the methods here must
+    be called on the message thread.
+*/
+class ColumnTextSearch : private AsyncUpdater {
+public:
+    /** Returns the text for a column. This is called on the pool's threads. */
+    using TextSource = std::function<String(int)>;
+
+    ColumnTextSearch();
+
+    ~ColumnTextSearch() override;
+
+    //==============================================================================
+    /** Starts searching columns [0, numCols) for the given text.
+        Any search that's already running is cancelled and its matches are cleared.
+    */
+    void start(const String &textToFind, bool ignoreCase, int numCols, TextSource textSource);
+
+    /** Searches all the columns again for the current text, e.g. after they've been
+        reordered. This never just re-checks the previous matches.
+    */
+    void restart(int numCols);
+
+    /** Checks some more columns against the current search text, keeping the matches
+        that have already been found - e.g. for columns that have just been appended.
+    */
+    void scanMore(Range<int> cols);
+
+    /** Throws away any matches at or beyond the given column number. */
+    void trimToSize(int numCols);
+
+    /** Moves the matches to account for some columns having been removed, so that the
+        columns after them don't have to be searched again. If a search is still running,
+        it's restarted instead, as it'll be looking at the old column numbers.
+    */
+    void removeCols(Range<int> cols);
+
+    /** Moves the matches to account for some columns having been inserted, and searches
+        the new ones. If a search is still running, it's restarted instead.
+    */
+    void insertCols(Range<int> cols);
+
+    /** Moves the matches to account for a range of columns having been replaced by a
+        different number of columns, and searches the new ones. If a search is still
+        running, it's restarted instead, just once.
+    */
+    void replaceCols(Range<int> oldCols, Range<int> newCols);
+
+    /** Checks some columns against the search text again, e.g. because their text has
+        changed, dropping any of their matches that no longer match.
+    */
+    void rescanCols(Range<int> cols);
+
+    /** Cancels any running search and clears the search text and matches. */
+    void clear();
+
+    //==============================================================================
+    /** Returns the matches found so far. */
+    const IntervalSet &getMatches() const noexcept { return matches; }
+
+    /** Returns the text that's being searched for. */
+    const String &getSearchText() const noexcept { return searchText; }
+
+    /** Returns true while any columns are still waiting to be checked. */
+    bool isSearching() const noexcept { return !activeScans.empty(); }
+
+    /** Called on the message thread with each batch of newly-found matches. */
+    std::function<void(const IntervalSet &)> onMatchesFound;
+
+    /** Called on the message thread when every column has been checked. */
+    std::function<void()> onSearchFinished;
+
+private:
+    //==============================================================================
+    struct Scan;
+    struct WorkerState;
+
+    SharedResourcePointer<ListWorkerPool> pool;
+    std::shared_ptr<WorkerState> workerState;
+    std::vector<std::shared_ptr<Scan>> activeScans;
+
+    IntervalSet matches;
+    String searchText;
+    TextSource source;
+    int numColsSearched = 0;
+    bool searchIgnoresCase = true, lastSearchCompleted = false;
+
+    void launchScan(const Array<Range<int>> &colsToScan);
+
+    void cancelScans();
+
+    void handleAsyncUpdate() override;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ColumnTextSearch)
+};
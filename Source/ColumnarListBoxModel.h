@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    ColumnarListBoxModel.h
+    Created: 18 Oct 2026 8:03:12pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBoxModel.h"
+#include "ColumnarStore.h"
+
+/**
+    A base class for models whose items are built in-process, which keeps them in a
+    ColumnarStore and their text in a StringArena.
+
+    Each item is a row of typed fields, and text fields are ArenaString handles, so
+    adding an item never allocates a String, and the memory used for each item is
+    just the size of its fields plus its share of the distinct strings. Subclasses
+    paint the items, reading the fields they need with getItems().get<field>().
+
+    @code
+    struct FileStripModel : public ColumnarListBoxModel<ArenaString, int64> {  // name, size
+        void paintListBoxItem(int row, Graphics &g, int w, int h, bool selected) override {
+            g.drawText(String(getText(getItems().get<0>(row))), 0, 0, w, h, Justification::centred);
+        }
+    };
+
+    model.addItems(files.begin(), files.end(), [&](const File &f) {
+        return std::make_tuple(model.intern(f.getFileName()), f.getSize());
+    });
+    @endcode
+
+    The arena keeps every string it's given until clear() is called, so this suits
+    data that's built and then replaced, rather than a stream that drops old items.
+    Like the store, this must only be used on the message thread.
+*/
+template <typename... FieldTypes>
+class ColumnarListBoxModel : public HorizontalListBoxModel {
+public:
+    using Store = ColumnarStore<FieldTypes...>;
+
+    //==============================================================================
+    /** Adds a string to the model's arena, returning the handle to store in a field. */
+    ArenaString intern(StringRef text) { return strings.intern(text); }
+
+    /** Returns the text for a handle that was returned by intern(). */
+    StringRef getText(ArenaString handle) const noexcept { return strings.get(handle); }
+
+    /** Adds an item. Call updateContent() on the list afterwards. */
+    void addItem(FieldTypes... fields) { items.add(std::move(fields)...); }
+
+    /** Adds an item for each element in a range; see ColumnarStore::addRange().
+        Call updateContent() on the list afterwards.
+    */
+    template <typename Iterator, typename RowFunction>
+    void addItems(Iterator first, Iterator last, RowFunction makeRow) {
+        items.addRange(first, last, makeRow);
+    }
+
+    /** Makes room for a number of items, so adding them won't have to reallocate. */
+    void reserve(int numItems) { items.reserve(numItems); }
+
+    /** Removes all the items and strings. Call allColsChanged() on the list afterwards. */
+    void clear() {
+        items.clear();
+        strings.clear();
+    }
+
+    /** Returns the items. */
+    const Store &getItems() const noexcept { return items; }
+
+    /** Returns roughly how much memory the items and their strings are using, in bytes. */
+    size_t getNumBytesUsed() const noexcept { return items.getNumBytesUsed() + strings.getNumBytesUsed(); }
+
+    //==============================================================================
+    /** @internal */
+    int getNumRows() override { return items.size(); }
+
+protected:
+    //==============================================================================
+    Store items;
+    StringArena strings;
+};
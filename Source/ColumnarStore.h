@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+
+    ColumnarStore.h
+    Created: 18 Oct 2026 7:17:13pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "StringArena.h"
+
+/**
+    Item storage for a model, laid out as one array per field rather than one
+    object per item.
+
+    Painting a column usually only reads one or two fields of each item, and with
+    this layout those reads are packed together rather than spread across whole
+    item objects. Use ArenaString for text fields, with a StringArena to hold the
+    text, so that adding an item never allocates a string of its own.
+
+    @code
+    StringArena names;
+    ColumnarStore<ArenaString, int64, float> items;   // name, size, rating
+
+    items.addRange(files.begin(), files.end(), [&](const File &f) {
+        return std::make_tuple(names.intern(f.getFileName()), f.getSize(), 0.0f);
+    });
+
+    auto size = items.get<1>(row);
+    @endcode
+
+    This isn't thread-safe.
+*/
+template <typename... FieldTypes>
+class ColumnarStore {
+public:
+    static constexpr size_t numFields = sizeof...(FieldTypes);
+
+    /** The type of one of the fields. */
+    template <size_t field>
+    using FieldType = typename std::tuple_element<field, std::tuple<FieldTypes...>>::type;
+
+    //==============================================================================
+    /** Returns the number of items. */
+    int size() const noexcept { return (int) std::get<0>(columns).size(); }
+
+    /** Makes room for a number of items, so adding them won't have to reallocate. */
+    void reserve(int numItems) {
+        forEachColumn([numItems](auto &column) { column.reserve((size_t) numItems); });
+    }
+
+    /** Adds an item. */
+    void add(FieldTypes... fields) {
+        addRow(std::forward_as_tuple(std::move(fields)...), Indices());
+    }
+
+    /** Adds an item for each element in a range, using a function that turns an
+        element into a std::tuple of field values.
+
+        If the iterators can be used to find the size of the range up-front, the
+        space for all the items is reserved before any are added.
+    */
+    template <typename Iterator, typename RowFunction>
+    void addRange(Iterator first, Iterator last, RowFunction makeRow) {
+        reserveFor(first, last, typename std::iterator_traits<Iterator>::iterator_category());
+
+        for (; first != last; ++first)
+            addRow(makeRow(*first), Indices());
+    }
+
+    /** Removes all the items, keeping the memory they used. */
+    void clear() {
+        forEachColumn([](auto &column) { column.clear(); });
+    }
+
+    //==============================================================================
+    /** Returns one field of an item. The index must be in range. */
+    template <size_t field>
+    const FieldType<field> &get(int index) const noexcept {
+        jassert(isPositiveAndBelow(index, size()));
+        return std::get<field>(columns)[(size_t) index];
+    }
+
+    /** Changes one field of an item. The index must be in range. */
+    template <size_t field>
+    void set(int index, FieldType<field> newValue) {
+        jassert(isPositiveAndBelow(index, size()));
+        std::get<field>(columns)[(size_t) index] = std::move(newValue);
+    }
+
+    /** Returns all the values of one field, in item order. */
+    template <size_t field>
+    const std::vector<FieldType<field>> &getColumn() const noexcept { return std::get<field>(columns); }
+
+    /** Returns roughly how much memory the items are using, in bytes. This doesn't
+        include anything the fields point to, e.g. a StringArena.
+    */
+    size_t getNumBytesUsed() const noexcept {
+        size_t total = 0;
+        forEachColumn([&total](auto &column) { total += column.capacity() * sizeof(column[0]); });
+        return total;
+    }
+
+private:
+    //==============================================================================
+    using Indices = std::index_sequence_for<FieldTypes...>;
+
+    std::tuple<std::vector<FieldTypes>...> columns;
+
+    template <typename Row, size_t... fields>
+    void addRow(Row &&row, std::index_sequence<fields...>) {
+        using Expander = int[];
+        (void) Expander{0, (std::get<fields>(columns).push_back(std::get<fields>(std::forward<Row>(row))), 0)...};
+    }
+
+    template <typename Function>
+    void forEachColumn(Function &&function) {
+        forEachColumn(function, Indices());
+    }
+
+    template <typename Function>
+    void forEachColumn(Function &&function) const {
+        forEachColumn(function, Indices());
+    }
+
+    template <typename Function, size_t... fields>
+    void forEachColumn(Function &function, std::index_sequence<fields...>) {
+        using Expander = int[];
+        (void) Expander{0, (function(std::get<fields>(columns)), 0)...};
+    }
+
+    template <typename Function, size_t... fields>
+    void forEachColumn(Function &function, std::index_sequence<fields...>) const {
+        using Expander = int[];
+        (void) Expander{0, (function(std::get<fields>(columns)), 0)...};
+    }
+
+    template <typename Iterator>
+    void reserveFor(Iterator first, Iterator last, std::forward_iterator_tag) {
+        reserve(size() + (int) std::distance(first, last));
+    }
+
+    template <typename Iterator>
+    void reserveFor(Iterator, Iterator, std::input_iterator_tag) {}
+
+    JUCE_LEAK_DETECTOR (ColumnarStore)
+};
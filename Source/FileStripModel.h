@@ -0,0 +1,259 @@
+/*
+  ==============================================================================
+
+    FileStripModel.h
+    Created: 18 Oct 2026 8:31:07pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBox.h"
+#include "ListBoxModelView.h"
+#include "PrioritisedLoader.h"
+#include "LruCache.h"
+
+/**
+    A base class for models that show a strip of files, each drawn from something
+    that's slow to make from the file, like a thumbnail.
+
+    Nothing is read on the message thread: a subclass's loadItem() is called on the
+    ListWorkerPool, nearest the middle of the screen first, and painting only ever
+    uses items that are already in the cache. Columns that are about to scroll into
+    view are loaded in advance.
+
+    Items are made for a target, such as the size the columns are drawn at, which the
+    subclass works out from the column size with getTargetFor(). When the target
+    changes, any items that aren't good enough for it are made again, but the old
+    ones can still be drawn until they've been replaced.
+
+    ItemType must have a getSizeInBytes() method, which is used to keep the cache
+    within its budget. A subclass must call stopLoading() in its destructor, because
+    the loader's tasks call its methods.
+
+    Give it the HorizontalListBox that's displaying it with setListBox(), so that it
+    can repaint columns as their items arrive.
+*/
+template <typename ItemType, typename TargetType>
+class FileStripModel : public HorizontalListBoxModel,
+                       private AsyncUpdater {
+public:
+    using ItemPtr = std::shared_ptr<const ItemType>;
+
+    ~FileStripModel() override {
+        // the subclass has gone by now, so its tasks mustn't still be running
+        jassert(loadingStopped);
+    }
+
+    /** Sets the list that should be repainted when items are loaded.
+        The list should be using this as its model, either directly or through a
+        ListBoxModelView.
+    */
+    void setListBox(HorizontalListBox *listToRepaint) noexcept { listBox = listToRepaint; }
+
+    //==============================================================================
+    /** Replaces the files being shown. Items already in the cache are kept. */
+    void setFiles(const Array<File> &newFiles) {
+        loader.clear();
+
+        {
+            const SpinLock::ScopedLockType sl(filesLock);
+            files = newFiles;
+        }
+
+        if (listBox != nullptr)
+            listBox->allColsChanged();
+    }
+
+    /** Adds a file to the end of the strip. */
+    void addFile(const File &file) {
+        {
+            const SpinLock::ScopedLockType sl(filesLock);
+            files.add(file);
+        }
+
+        if (listBox != nullptr)
+            listBox->updateContent();
+    }
+
+    /** Returns the file shown in a column. */
+    File getFile(int index) const { return files[index]; }
+
+    /** Returns the number of files in the strip. */
+    int getNumFiles() const noexcept { return files.size(); }
+
+    //==============================================================================
+    /** Sets the most memory the cached items can use. */
+    void setCacheSizeBytes(int64 maxBytes) { cache.setMaxBytes(maxBytes); }
+
+    /** Returns the limit set with setCacheSizeBytes(). */
+    int64 getCacheSizeBytes() const noexcept { return cache.getMaxBytes(); }
+
+    //==============================================================================
+    /** @internal */
+    int getNumRows() override { return files.size(); }
+
+    /** @internal */
+    void paintListBoxItem(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected) override {
+        paintListBoxItemWithDetail(rowNumber, g, width, height, rowIsSelected, DetailLevel::full);
+    }
+
+    /** @internal */
+    String getTooltipForRow(int row) override { return getFile(row).getFullPathName(); }
+
+    /** @internal */
+    String getTextForCol(int colNumber) override {
+        const SpinLock::ScopedLockType sl(filesLock);
+        return files[colNumber].getFileName();
+    }
+
+    /** @internal */
+    void visibleColsChanged(Range<int> visibleCols, Range<int> colsToPrefetch, int colWidth, int colHeight) override {
+        loadItems(IntervalSet(visibleCols.getUnionWith(colsToPrefetch)),
+                  visibleCols.getStart() + visibleCols.getLength() / 2, colWidth, colHeight);
+    }
+
+    /** @internal */
+    void visibleItemsChanged(const IntervalSet &visibleItems, const IntervalSet &itemsToPrefetch,
+                             int centreItem, int colWidth, int colHeight) override {
+        auto wanted = visibleItems;
+        wanted.addSet(itemsToPrefetch);
+        loadItems(wanted, centreItem, colWidth, colHeight);
+    }
+
+protected:
+    //==============================================================================
+    /** Creates a model whose cache holds up to this many bytes of items. */
+    explicit FileStripModel(int64 cacheSizeBytes) : cache(cacheSizeBytes) {}
+
+    /** Returns the target that items should be made for, for columns of this size. */
+    virtual TargetType getTargetFor(int colWidth, int colHeight) const = 0;
+
+    /** Returns true if an item is good enough to draw for a target without making it again. */
+    virtual bool isGoodEnoughFor(const ItemType &item, const TargetType &target) const = 0;
+
+    /** Makes the item for a file. This is called on the loader's threads. It should
+        return an item even if the file can't be read, so that it isn't retried on
+        every paint, or nullptr to not cache anything, e.g. if it gave up early.
+    */
+    virtual ItemPtr loadItem(const File &file, const TargetType &target) = 0;
+
+    /** Returns the cached item for a column's file, which may be null or made for an
+        old target, and asks for a new one to be loaded if it isn't good enough.
+    */
+    ItemPtr findItem(int col, const File &file) {
+        auto item = cache.find(file.getFullPathName());
+
+        if (item == nullptr || !isGoodEnoughFor(*item, target))
+            requestItem(col, file);
+
+        return item;
+    }
+
+    /** Returns the target that items are currently being made for. */
+    const TargetType &getTarget() const noexcept { return target; }
+
+    /** Drops any queued items and waits for the ones being loaded. Call this at the
+        start of the subclass's destructor.
+    */
+    void stopLoading() {
+        loader.shutDown();
+        loadingStopped = true;
+    }
+
+    Component::SafePointer<HorizontalListBox> listBox;
+
+private:
+    //==============================================================================
+    struct ItemSize {
+        int64 operator()(const ItemPtr &item) const noexcept { return item != nullptr ? item->getSizeInBytes() : 0; }
+    };
+
+    struct PathHash {
+        size_t operator()(const String &s) const noexcept { return (size_t) s.hashCode64(); }
+    };
+
+    // items keyed by the file's path, which can be used from the loader's threads
+    // as well as the message thread
+    using ItemCache = LruCache<String, ItemPtr, ItemSize, PathHash, CriticalSection>;
+
+    // getTextForCol() is called on the search threads, so the file list is only
+    // changed while holding this lock
+    SpinLock filesLock;
+    Array<File> files;
+
+    ItemCache cache;
+    TargetType target{};
+    bool loadingStopped = false;
+
+    SpinLock loadedLock;
+    Array<int> loadedCols;
+
+    PrioritisedLoader loader;
+
+    void loadItems(const IntervalSet &wanted, int centreItem, int colWidth, int colHeight) {
+        const auto newTarget = getTargetFor(colWidth, colHeight);
+
+        // anything queued is now for the wrong target - the visible columns get re-queued below
+        if (newTarget != target) {
+            target = newTarget;
+            loader.clear();
+        }
+
+        if (centreItem >= 0)
+            loader.setCentre(centreItem);
+
+        loader.retainOnly(wanted);
+
+        for (auto &r : wanted)
+            for (auto col = r.getStart(); col < r.getEnd(); ++col)
+                findItem(col, getFile(col));
+    }
+
+    void requestItem(int col, const File &file) {
+        if (target == TargetType() || file == File())
+            return;
+
+        const auto itemTarget = target;
+
+        loader.addTask(col, [this, col, file, itemTarget] {
+            auto item = loadItem(file, itemTarget);
+
+            if (item == nullptr)
+                return;
+
+            cache.add(file.getFullPathName(), std::move(item));
+
+            {
+                const SpinLock::ScopedLockType sl(loadedLock);
+                loadedCols.addIfNotAlreadyThere(col);
+            }
+
+            triggerAsyncUpdate();
+        });
+    }
+
+    void handleAsyncUpdate() override {
+        Array<int> cols;
+
+        {
+            const SpinLock::ScopedLockType sl(loadedLock);
+            cols.swapWith(loadedCols);
+        }
+
+        // the list may be showing this model through a ListBoxModelView, so its columns
+        // needn't be the same as our item numbers
+        if (listBox != nullptr)
+            for (auto col : cols) {
+                const auto listCol = ListBoxModelView::findColShowingItem(*listBox, *this, col);
+
+                if (listCol >= 0)
+                    listBox->repaintCol(listCol);
+            }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FileStripModel)
+};
@@ -9,29 +9,185 @@
 */
 
 #include "HorizontalListBox.h"
+#include "ColumnTextSearch.h"
 
+using Callback = ModelCallStats::Callback;
 
+namespace {
+    // Makes a call into the model, timing it if the list has timing turned on.
+    template <typename Function>
+    auto timeModelCall(ModelCallStats *stats, const Callback callback, const int item,
+                       Function &&call) -> decltype(call()) {
+        const ModelCallStats::ScopedCall timing(stats, callback, item);
+        return call();
+    }
+}
+
+
+//==============================================================================
+// Keeps track of how fast the list is scrolling and how long a column takes to
+// paint, to decide whether there's time to paint the columns in full detail.
+class HorizontalListBox::ScrollSpeedTracker : private Timer {
+public:
+    using DetailLevel = HorizontalListBoxModel::DetailLevel;
+
+    ScrollSpeedTracker(HorizontalListBox &lb) : owner(lb) {}
+
+    void setThresholds(const float colsPerSecond, const double paintBudgetMs) noexcept {
+        fastSpeed = jmax(0.0f, colsPerSecond);
+        paintBudget = jmax(0.0, paintBudgetMs);
+
+        if (fastSpeed <= 0)
+            setFullDetail();
+    }
+
+    DetailLevel getDetailLevel() const noexcept { return detail; }
+
+    // for when the position jumps without anything scrolling, e.g. when a zoom lays the
+    // columns out at a new width, so that the jump isn't taken for a fast scroll
+    void setPosition(const double newX) noexcept { lastX = newX; }
+
+    void positionChanged(const double newX) {
+        const auto now = Time::getMillisecondCounterHiRes();
+        const auto elapsed = now - lastMoveTime;
+
+        if (lastMoveTime > 0 && elapsed > 0 && elapsed < settleTimeMs) {
+            const auto colsPerSecond = std::abs(newX - lastX) * 1000.0 / (elapsed * jmax(1, owner.getColWidth()));
+
+            // scroll events arrive unevenly, so the speed is smoothed over a few of them
+            speed += (colsPerSecond - speed) * jmin(1.0, elapsed / smoothingTimeMs);
+        } else {
+            speed = 0;
+        }
+
+        lastX = newX;
+        lastMoveTime = now;
+        startTimer(settleTimeMs / 2);
+
+        if (fastSpeed <= 0)
+            return;
+
+        // the cost of painting the columns that come into view in one frame
+        const auto paintCostPerFrame = speed / framesPerSecond * colPaintTime;
+
+        if (speed > fastSpeed || paintCostPerFrame > paintBudget)
+            detail = DetailLevel::reduced;
+        else if (speed < fastSpeed * 0.5 && paintCostPerFrame < paintBudget * 0.5)
+            setFullDetail();
+    }
+
+    void colPainted(const DetailLevel paintedDetail, const double milliseconds) {
+        // reduced paints are cheap by design, so they'd make the estimate useless
+        if (paintedDetail == DetailLevel::full)
+            colPaintTime += (milliseconds - colPaintTime) * 0.1;
+    }
+
+private:
+    void setFullDetail() {
+        if (detail != DetailLevel::full) {
+            detail = DetailLevel::full;
+            owner.repaintColsWithReducedDetail();
+        }
+    }
+
+    void timerCallback() override {
+        if (Time::getMillisecondCounterHiRes() - lastMoveTime >= settleTimeMs) {
+            stopTimer();
+            speed = 0;
+            setFullDetail();
+            owner.scrollSettled();
+        }
+    }
+
+    static constexpr int settleTimeMs = 120;
+    static constexpr double smoothingTimeMs = 50.0, framesPerSecond = 60.0;
+
+    HorizontalListBox &owner;
+    DetailLevel detail = DetailLevel::full;
+    float fastSpeed = 40.0f;
+    double paintBudget = 8.0, speed = 0, colPaintTime = 0, lastMoveTime = 0, lastX = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ScrollSpeedTracker)
+};
+
+
+//==============================================================================
 class HorizontalListBox::ColumnComponent : public Component,
                                            public TooltipClient {
 public:
     ColumnComponent(HorizontalListBox &lb) : owner(lb) {}
 
     void paint(Graphics &g) override {
-        if (auto *m = owner.getModel())
-            m->paintListBoxItem(col, g, getWidth(), getHeight(), selected);
+        auto &tracker = *owner.scrollSpeedTracker;
+
+        // until its component has been refreshed, a column that's been moved to a new item
+        // is painted as a placeholder at reduced detail; carousels are always painted in
+        // full, because they're drawn from their cached images
+        const auto detail = isPlaceholder() ? HorizontalListBoxModel::DetailLevel::reduced
+                                            : owner.carouselMode ? HorizontalListBoxModel::DetailLevel::full
+                                                                 : tracker.getDetailLevel();
+        const auto startTime = Time::getMillisecondCounterHiRes();
+        const ModelCallStats::ScopedCall timing(owner.callStats.get(), Callback::paintListBoxItem, col, owner.tracer);
+
+        auto paintItem = [this, detail](Graphics &itemG) {
+            if (auto *em = owner.extendedModel)
+                em->paintListBoxItemWithDetail(col, itemG, getWidth(), getHeight(), selected, detail);
+            else if (auto *m = owner.getModel())
+                m->paintListBoxItem(col, itemG, getWidth(), getHeight(), selected);
+        };
+
+        // cheaper versions of the item are never kept, as it'll be repainted in full soon, and
+        // nor are the steps of a zoom animation: the zoom is a transform on the content, which
+        // changes the pixel scale every frame, so each step would only push out useful images
+        auto *cache = owner.isAnimatingZoom() ? nullptr : owner.getCacheForPainting();
+
+        if (cache != nullptr && owner.model != nullptr && detail == HorizontalListBoxModel::DetailLevel::full)
+            cache->draw(g, owner.model, owner.getCacheKeyForCol(col), getWidth(), getHeight(), selected,
+                        paintItem, carouselScale);
+        else
+            paintItem(g);
+
+        paintedDetail = detail;
+        tracker.colPainted(detail, Time::getMillisecondCounterHiRes() - startTime);
     }
 
+    // Binds the column to an item. This only changes what's painted: the model's component
+    // isn't refreshed until refresh() is called, and if the column has moved to a different
+    // item, the old one is hidden until then.
     void update(const int newCol, const bool nowSelected) {
+        HORIZONTAL_LIST_TRACE_SCOPE(owner.tracer, "ColumnComponent::update", newCol);
+
         if (col != newCol || selected != nowSelected) {
             repaint();
             col = newCol;
             selected = nowSelected;
         }
 
+        itemId = owner.getItemIdForCol(col);
+
+        if (customComponent != nullptr && isPlaceholder())
+            customComponent->setVisible(false);
+
+        needsRefresh = true;
+    }
+
+    void refresh() {
+        if (isPlaceholder())
+            repaint();
+
+        needsRefresh = false;
+        refreshedCol = col;
+        refreshedItemId = itemId;
+
         if (auto *m = owner.getModel()) {
-            setMouseCursor(m->getMouseCursorForRow(col));
+            setMouseCursor(timeModelCall(owner.callStats.get(), Callback::getMouseCursorForRow, col,
+                                         [&] { return m->getMouseCursorForRow(col); }));
 
-            customComponent.reset(m->refreshComponentForRow(newCol, nowSelected, customComponent.release()));
+            {
+                const ModelCallStats::ScopedCall timing(owner.callStats.get(), Callback::refreshComponentForRow, col,
+                                                        owner.tracer);
+                customComponent.reset(m->refreshComponentForRow(col, selected, customComponent.release()));
+            }
 
             if (customComponent != nullptr) {
                 addAndMakeVisible(customComponent.get());
@@ -40,11 +196,40 @@ public:
         }
     }
 
+    // Called when a different item has moved to the column's index, so that the column is
+    // repainted, and its component refreshed when it's next updated, even though its index
+    // is the same.
+    void itemChanged() {
+        refreshedCol = -1;
+        repaint();
+    }
+
+    // when the items have IDs, a column that's been moved to a different index can still
+    // be showing the right item
+    bool isPlaceholder() const noexcept {
+        return needsRefresh && (itemId >= 0 ? refreshedItemId != itemId : refreshedCol != col);
+    }
+
+    // Swaps custom components with another column, when the items they were made for
+    // have moved between the two.
+    void swapCustomComponents(ColumnComponent &other) {
+        std::swap(customComponent, other.customComponent);
+        std::swap(refreshedItemId, other.refreshedItemId);
+
+        for (auto *colComp : { this, &other }) {
+            if (colComp->customComponent != nullptr) {
+                colComp->addAndMakeVisible(colComp->customComponent.get());
+                colComp->customComponent->setBounds(colComp->getLocalBounds());
+            }
+        }
+    }
+
     void performSelection(const MouseEvent &e, bool isMouseUp) {
         owner.selectColsBasedOnModifierKeys(col, e.mods, isMouseUp);
 
         if (auto *m = owner.getModel())
-            m->listBoxItemClicked(col, e);
+            timeModelCall(owner.callStats.get(), Callback::listBoxItemClicked, col,
+                          [&] { m->listBoxItemClicked(col, e); });
     }
 
     bool isInDragToScrollViewport() const noexcept {
@@ -75,7 +260,8 @@ public:
     void mouseDoubleClick(const MouseEvent &e) override {
         if (isEnabled())
             if (auto *m = owner.getModel())
-                m->listBoxItemDoubleClicked(col, e);
+                timeModelCall(owner.callStats.get(), Callback::listBoxItemDoubleClicked, col,
+                              [&] { m->listBoxItemDoubleClicked(col, e); });
     }
 
     void mouseDrag(const MouseEvent &e) override {
@@ -84,12 +270,13 @@ public:
                 SparseSet<int> colsToDrag;
 
                 if (owner.selectOnMouseDown || owner.isColSelected(col))
-                    colsToDrag = owner.getSelectedCols();
+                    colsToDrag = owner.getSelection().toSparseSet();
                 else
                     colsToDrag.addRange(Range<int>::withStartAndLength(col, 1));
 
                 if (colsToDrag.size() > 0) {
-                    auto dragDescription = m->getDragSourceDescription(colsToDrag);
+                    auto dragDescription = timeModelCall(owner.callStats.get(), Callback::getDragSourceDescription,
+                                                         col, [&] { return m->getDragSourceDescription(colsToDrag); });
 
                     if (!(dragDescription.isVoid() ||
                           (dragDescription.isString() && dragDescription.toString().isEmpty()))) {
@@ -112,22 +299,106 @@ public:
 
     String getTooltip() override {
         if (auto *m = owner.getModel())
-            return m->getTooltipForRow(col);
+            return timeModelCall(owner.callStats.get(), Callback::getTooltipForRow, col,
+                                 [&] { return m->getTooltipForRow(col); });
 
         return {};
     }
 
     HorizontalListBox &owner;
     std::unique_ptr<Component> customComponent;
-    int col = -1;
-    bool selected = false, isDragging = false, isDraggingToScroll = false, selectColOnMouseUp = false;
+    HorizontalListBoxModel::DetailLevel paintedDetail = HorizontalListBoxModel::DetailLevel::full;
+    int col = -1, refreshedCol = -1;
+    int64 itemId = -1, refreshedItemId = -1;
+    float carouselScale = 1.0f;
+    bool selected = false, needsRefresh = false;
+    bool isDragging = false, isDraggingToScroll = false, selectColOnMouseUp = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ColumnComponent)
 };
 
 
 //==============================================================================
-class HorizontalListBox::ListViewport : public Viewport {
+// Spreads the model's refreshComponentForRow() calls across frames. A jump (Home/End,
+// a scrollbar drag, etc.) moves every column to a new item at once, and refreshing
+// all of their components in one go can take several frames if they're complicated.
+// Instead, the columns nearest the middle of the view are refreshed first, until the
+// frame's budget has been used, and the rest are painted as placeholders and done on
+// the frames that follow.
+class HorizontalListBox::RefreshScheduler : private Timer {
+public:
+    RefreshScheduler(HorizontalListBox &lb) : owner(lb) {}
+
+    void add(ColumnComponent *colComp) {
+        pending.push_back(colComp);
+    }
+
+    // Refreshes as many of the columns that have been added as fit in this frame,
+    // starting with the ones nearest to centreX in the content.
+    void start(const int centreX) {
+        // the nearest go at the end, so that they can be popped off
+        std::sort(pending.begin(), pending.end(), [centreX](ColumnComponent *a, ColumnComponent *b) {
+            return std::abs(a->getBounds().getCentreX() - centreX) > std::abs(b->getBounds().getCentreX() - centreX);
+        });
+
+        refreshWithinBudget();
+    }
+
+    // Refreshes a column now if it's still waiting, e.g. because its component is needed.
+    void refreshNow(ColumnComponent &colComp) {
+        auto found = std::find(pending.begin(), pending.end(), &colComp);
+
+        if (found != pending.end()) {
+            pending.erase(found);
+            colComp.refresh();
+        }
+    }
+
+    void remove(ColumnComponent &colComp) {
+        pending.erase(std::remove(pending.begin(), pending.end(), &colComp), pending.end());
+    }
+
+    // Forgets all the columns, which has to happen before any of them are deleted.
+    void clear() {
+        stopTimer();
+        pending.clear();
+    }
+
+private:
+    void refreshWithinBudget() {
+        HORIZONTAL_LIST_TRACE_SCOPE(owner.tracer, "refreshWithinBudget", -1);
+        const auto startTime = Time::getMillisecondCounterHiRes();
+
+        // at least one column is refreshed each frame, so that they always get done
+        while (!pending.empty()) {
+            auto *colComp = pending.back();
+            pending.pop_back();
+            colComp->refresh();
+
+            if (owner.refreshBudgetMs > 0 && Time::getMillisecondCounterHiRes() - startTime >= owner.refreshBudgetMs)
+                break;
+        }
+
+        if (pending.empty())
+            stopTimer();
+        else if (!isTimerRunning())
+            startTimerHz(60);
+    }
+
+    void timerCallback() override {
+        refreshWithinBudget();
+    }
+
+    HorizontalListBox &owner;
+    std::vector<ColumnComponent *> pending; // a vector, so that emptying it each frame keeps its storage
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RefreshScheduler)
+};
+
+
+//==============================================================================
+class HorizontalListBox::ListViewport : public Viewport,
+                                         private Timer {
 public:
     ListViewport(HorizontalListBox &lb) : owner(lb) {
         setWantsKeyboardFocus(false);
@@ -138,17 +409,50 @@ public:
     }
 
     ColumnComponent *getComponentForCol(const int col) const noexcept {
-        return cols[col % jmax(1, cols.size())];
+        const auto index = col % jmax(1, (int) cols.size());
+        return isPositiveAndBelow(index, (int) cols.size()) ? cols[(size_t) index].get() : nullptr;
     }
 
     ColumnComponent *getComponentForColIfOnscreen(const int col) const noexcept {
-        return (col >= firstIndex && col < firstIndex + cols.size())
+        return (col >= firstIndex && col < firstIndex + (int) cols.size())
                ? getComponentForCol(col) : nullptr;
     }
 
+    // Marks the on-screen columns in a range as showing different items, for when the items
+    // at those indices have changed without the indices themselves changing. They're rebound
+    // by the next updateContents().
+    void itemsChangedIn(const Range<int> changedCols) {
+        for (auto &colComp : cols)
+            if (changedCols.contains(colComp->col))
+                colComp->itemChanged();
+    }
+
+    // Rebinds one column and refreshes it straight away, if it's on screen.
+    void refreshCol(const int col, const bool isSelected) {
+        if (auto *colComp = getComponentForColIfOnscreen(col)) {
+            colComp->update(col, isSelected);
+            refresher.remove(*colComp);
+            colComp->refresh();
+            colComp->repaint();
+        }
+    }
+
+    // Returns a column's component from the model, refreshing it first if it's still waiting.
+    Component *getCustomComponentForCol(const int col) {
+        if (auto *colComp = getComponentForColIfOnscreen(col)) {
+            refresher.refreshNow(*colComp);
+            return colComp->customComponent.get();
+        }
+
+        return nullptr;
+    }
+
     int getColNumberOfComponent(Component *const colComponent) const noexcept {
-        const int index = getViewedComponent()->getIndexOfChildComponent(colComponent);
-        const int num = cols.size();
+        // spare columns are children of the content too, so its child indexes can't be used
+        const auto found = std::find_if(cols.begin(), cols.end(),
+                                        [colComponent](const std::unique_ptr<ColumnComponent> &c) { return c.get() == colComponent; });
+        const int index = found != cols.end() ? (int) (found - cols.begin()) : -1;
+        const int num = (int) cols.size();
 
         for (int i = num; --i >= 0;)
             if (((firstIndex + i) % jmax(1, num)) == index)
@@ -157,14 +461,145 @@ public:
         return -1;
     }
 
+    double getExactViewPositionX() const noexcept { return exactX; }
+
+    // The viewport can only be scrolled by whole pixels, so the fraction that's left over
+    // is applied as a transform on the content, which moves all the columns at once.
+    void setExactViewPositionX(double newX) {
+        auto &content = *getViewedComponent();
+        newX = jlimit(0.0, (double) jmax(0, content.getWidth() - getMaximumVisibleWidth()), newX);
+
+        const auto wholeX = (int) std::floor(newX);
+        exactX = newX;
+
+        if (wholeX != getViewPositionX()) {
+            const ScopedValueSetter<bool> svs(isSettingExactPosition, true);
+            setViewPosition(wholeX, getViewPositionY());
+        } else {
+            positionMoved();
+            applyFractionalOffset();
+            owner.listeners.call([this](Listener &l) { l.listWasScrolled(owner); });
+        }
+    }
+
+    void animateToX(const double targetX, const int durationMs) {
+        // the target is in terms of the final column width
+        finishZoom();
+
+        animationStartX = exactX;
+        animationTargetX = targetX;
+        animationStartTime = Time::getMillisecondCounterHiRes();
+        animationDurationMs = jmax(1, durationMs);
+        isAnimatingScroll = true;
+        startTimerHz(60);
+    }
+
+    // Returns the position in the content that's shown at an x position in the viewport.
+    double getContentX(const double viewX) const noexcept {
+        return zoomPivotX + (viewX - zoomPivotX) / zoomScale + exactX;
+    }
+
+    int getTargetColWidth() const noexcept { return isZooming ? zoomTargetColW : owner.colWidth; }
+
+    bool isAnimatingZoom() const noexcept { return isZooming; }
+
+    bool isLayingOutForZoom() const noexcept { return isZoomLayout; }
+
+    // While zooming is animated, the steps are drawn by scaling the content around the
+    // anchor point. The columns are only laid out again once, at whichever end of the
+    // animation has the narrower columns, because scaling those up never leaves a gap
+    // at the edges: so zooming out lays them out at the start, and zooming in at the end.
+    void zoomTo(const int newColW, const double anchorX, const int durationMs) {
+        const auto startColW = owner.colWidth * zoomScale;
+        const auto anchorCol = getContentX(anchorX) / owner.colWidth;
+
+        isZooming = false;
+        zoomScale = 1.0;
+
+        if (durationMs <= 0 || std::abs(startColW - newColW) < 0.5) {
+            layOutForZoom(newColW, anchorCol, anchorX);
+            stopTimerIfIdle();
+            return;
+        }
+
+        layOutForZoom(jmax(1, (int) std::floor(jmin(startColW, (double) newColW))), anchorCol, anchorX);
+
+        zoomStartColW = startColW;
+        zoomTargetColW = newColW;
+        zoomStartTime = Time::getMillisecondCounterHiRes();
+        zoomDurationMs = durationMs;
+        zoomScale = startColW / owner.colWidth;
+        isZooming = true;
+
+        applyFractionalOffset();
+        startTimerHz(60);
+    }
+
+    // Jumps to the end of a zoom animation.
+    void finishZoom() {
+        if (!isZooming)
+            return;
+
+        // the content under the pivot doesn't move while the scale changes
+        const auto anchorCol = getContentX(zoomPivotX) / owner.colWidth;
+
+        isZooming = false;
+        zoomScale = 1.0;
+        layOutForZoom(zoomTargetColW, anchorCol, zoomPivotX);
+        stopTimerIfIdle();
+    }
+
+    // Called when the list stops moving, so that a carousel can glide to the nearest
+    // column. That waits while a mouse button is down, e.g. on the scrollbar.
+    void scrollSettled() {
+        if (!owner.carouselMode || isAnimatingScroll || isZooming)
+            return;
+
+        if (ModifierKeys::getCurrentModifiersRealtime().isAnyMouseButtonDown()) {
+            isWaitingToSnap = true;
+            startTimerHz(60);
+            return;
+        }
+
+        snapToFocusedCol();
+    }
+
+    void snapToFocusedCol() {
+        focusCol(getFocusedCol(), true);
+    }
+
+    // Abandons a zoom animation, leaving the columns the width they're laid out at.
+    void cancelZoom() {
+        if (!isZooming)
+            return;
+
+        isZooming = false;
+        zoomScale = 1.0;
+        applyFractionalOffset();
+        stopTimerIfIdle();
+    }
+
     void visibleAreaChanged(const Rectangle<int> &) override {
+        // anything else that scrolls the viewport takes over from a scrolling animation
+        if (!isSettingExactPosition) {
+            exactX = getViewPositionX();
+            isAnimatingScroll = false;
+            stopTimerIfIdle();
+        }
+
+        applyFractionalOffset();
+        positionMoved();
+        owner.updateTailFollowing();
         updateVisibleArea(true);
 
         if (auto *m = owner.getModel())
-            m->listWasScrolled();
+            timeModelCall(owner.callStats.get(), Callback::listWasScrolled, -1, [m] { m->listWasScrolled(); });
+
+        owner.listeners.call([this](Listener &l) { l.listWasScrolled(owner); });
     }
 
     void updateVisibleArea(const bool makeSureItUpdatesContent) {
+        HORIZONTAL_LIST_TRACE_SCOPE(owner.tracer, "updateVisibleArea", -1);
         hasUpdated = false;
 
         auto &content = *getViewedComponent();
@@ -183,6 +618,7 @@ public:
     }
 
     void updateContents() {
+        HORIZONTAL_LIST_TRACE_SCOPE(owner.tracer, "updateContents", -1);
         hasUpdated = true;
         auto colW = owner.getColWidth();
         auto &content = *getViewedComponent();
@@ -192,26 +628,66 @@ public:
             auto h = content.getHeight();
 
             const int numNeeded = 2 + getMaximumVisibleWidth() / colW;
-            cols.removeRange(numNeeded, cols.size());
+            refresher.clear();
+
+            largestVisibleWidth = jmax(largestVisibleWidth, getMaximumVisibleWidth());
+            const int maxPooledCols = 2 + largestVisibleWidth / colW;
 
-            while (numNeeded > cols.size()) {
-                auto newColumn = new ColumnComponent(owner);
-                cols.add(newColumn);
-                content.addAndMakeVisible(newColumn);
+            // these are std::vectors rather than OwnedArrays, because an OwnedArray gives
+            // its storage back when it shrinks by half, so that a resize drag would keep
+            // reallocating it
+            while ((int) cols.size() > numNeeded) {
+                releaseCol(std::move(cols.back()), maxPooledCols);
+                cols.pop_back();
             }
 
+            while (numNeeded > (int) cols.size())
+                cols.push_back(obtainCol());
+
             firstIndex = x / colW;
             firstWholeIndex = (x + colW - 1) / colW;
             lastWholeIndex = (x + getMaximumVisibleWidth() - 1) / colW;
 
+            // walk the selected ranges alongside the columns rather than searching for each one
+            auto selectedOnScreen = owner.selected.getOverlappingRanges({firstIndex, firstIndex + numNeeded});
+            auto *nextSelected = selectedOnScreen.begin();
+
+            // after the items have been reordered, each column takes over the custom
+            // component that was made for its item, wherever that is now
+            componentsByItem.clear();
+
+            if (owner.itemsReordered) {
+                owner.itemsReordered = false;
+
+                for (auto &colComp : cols)
+                    if (colComp->customComponent != nullptr && colComp->refreshedItemId >= 0)
+                        componentsByItem[colComp->refreshedItemId] = colComp.get();
+            }
+
             for (int i = 0; i < numNeeded; ++i) {
                 const int col = i + firstIndex;
 
+                while (nextSelected != selectedOnScreen.end() && nextSelected->getEnd() <= col)
+                    ++nextSelected;
+
                 if (auto *colComp = getComponentForCol(col)) {
-                    colComp->setBounds(col * colW, 0, colW, h);
-                    colComp->update(col, owner.isColSelected(col));
+                    if (!componentsByItem.empty())
+                        takeOverComponentForItem(*colComp, owner.getItemIdForCol(col), componentsByItem);
+
+                    // scrolling moves the content, not the columns, so a column only needs
+                    // moving when it's rebound to a different item or resized
+                    if (colComp->col != col || colComp->getWidth() != colW || colComp->getHeight() != h)
+                        colComp->setBounds(col * colW, 0, colW, h);
+
+                    colComp->update(col, nextSelected != selectedOnScreen.end() && nextSelected->contains(col));
+                    refresher.add(colComp);
                 }
             }
+
+            refresher.start(x + getMaximumVisibleWidth() / 2);
+            updateCarouselTransforms();
+
+            notifyVisibleColsChanged(x, colW, h);
         }
 
         if (owner.headerComponent != nullptr)
@@ -246,6 +722,109 @@ public:
             updateContents();
     }
 
+    // In carousel mode, the column at the focus point is shown full size, and the others
+    // shrink and fade the further they are from it. The focus point is the middle of the
+    // view, except near the ends of the list, where it moves twice as fast as the list
+    // scrolls, so that it reaches the middle of the first and last columns.
+    double getFocusX() const noexcept {
+        const auto colW = (double) owner.colWidth;
+        const auto viewW = (double) getMaximumVisibleWidth();
+        const auto contentW = (double) getViewedComponent()->getWidth();
+        const auto maxX = contentW - viewW, edge = (viewW - colW) * 0.5;
+
+        if (maxX <= 0)
+            return exactX + viewW * 0.5;
+
+        // too short to have a middle section, so the focus just moves along in proportion
+        if (maxX < edge * 2)
+            return colW * 0.5 + exactX * (contentW - colW) / maxX;
+
+        if (exactX < edge)
+            return exactX * 2 + colW * 0.5;
+
+        if (exactX > maxX - edge)
+            return exactX * 2 - maxX + viewW - colW * 0.5;
+
+        return exactX + viewW * 0.5;
+    }
+
+    // the opposite of getFocusX()
+    double getScrollXForFocus(const double focusX) const noexcept {
+        const auto colW = (double) owner.colWidth;
+        const auto viewW = (double) getMaximumVisibleWidth();
+        const auto contentW = (double) getViewedComponent()->getWidth();
+        const auto maxX = contentW - viewW, edge = (viewW - colW) * 0.5;
+
+        if (maxX <= 0)
+            return 0;
+
+        double x;
+
+        if (maxX < edge * 2)
+            x = (focusX - colW * 0.5) * maxX / (contentW - colW);
+        else if (focusX < edge + viewW * 0.5)
+            x = (focusX - colW * 0.5) * 0.5;
+        else if (focusX > maxX - edge + viewW * 0.5)
+            x = (focusX + maxX - viewW + colW * 0.5) * 0.5;
+        else
+            x = focusX - viewW * 0.5;
+
+        return jlimit(0.0, maxX, x);
+    }
+
+    int getFocusedCol() const noexcept {
+        return jlimit(0, jmax(0, owner.totalItems - 1), (int) std::floor(getFocusX() / jmax(1, owner.colWidth)));
+    }
+
+    void focusCol(const int col, const bool animate) {
+        const auto targetX = getScrollXForFocus((col + 0.5) * owner.colWidth);
+
+        if (std::abs(targetX - exactX) < 0.5)
+            return;
+
+        if (animate)
+            animateToX(targetX, 200);
+        else
+            setExactViewPositionX(targetX);
+    }
+
+    // The scale and opacity of each column are smooth functions of its distance from the
+    // focus point, so they change continuously as the list scrolls. They're applied as
+    // transforms, and the columns are drawn from cached images at full size, so nothing
+    // has to be painted again while they change.
+    void updateCarouselTransforms() {
+        if (!(owner.carouselMode || hasCarouselTransforms))
+            return;
+
+        hasCarouselTransforms = owner.carouselMode;
+        const auto focusX = owner.carouselMode ? getFocusX() : 0.0;
+        const auto colW = (float) jmax(1, owner.colWidth);
+
+        for (auto &colComp : cols) {
+            auto scale = 1.0f, alpha = 1.0f;
+
+            if (owner.carouselMode) {
+                const auto distance = jmin(1.0f, std::abs((float) (colComp->getBounds().getCentreX() - focusX)) / colW);
+                const auto falloff = distance * distance * (3.0f - 2.0f * distance);
+
+                scale = 1.0f - (1.0f - owner.carouselMinScale) * falloff;
+                alpha = 1.0f - (1.0f - owner.carouselMinAlpha) * falloff;
+            }
+
+            // columns move when they're resized or rebound, so the centre can change too
+            const auto centre = colComp->getBounds().getCentre().toFloat();
+            colComp->carouselScale = scale;
+            colComp->setTransform(AffineTransform::scale(scale, scale, centre.x, centre.y));
+            colComp->setAlpha(alpha);
+        }
+    }
+
+    void repaintColsWithReducedDetail() {
+        for (auto &colComp : cols)
+            if (colComp->paintedDetail != HorizontalListBoxModel::DetailLevel::full)
+                colComp->repaint();
+    }
+
     void scrollToEnsureColIsOnscreen(const int col, const int colw) {
         if (col < firstWholeIndex) {
             setViewPosition(col * colw, getViewPositionY());
@@ -260,147 +839,879 @@ public:
             g.fillAll(owner.findColour(HorizontalListBox::backgroundColourId));
     }
 
-    bool keyPressed(const KeyPress &key) override {
-        if (Viewport::respondsToKey(key)) {
-            const int allowableMods = owner.multipleSelection ? ModifierKeys::shiftModifier : 0;
+    void mouseWheelMove(const MouseEvent &e, const MouseWheelDetails &wheel) override {
+        const auto &range = owner.wheelZoomRange;
+
+        if (!range.isEmpty() && e.mods.isCommandDown() && wheel.deltaY != 0) {
+            // The unrounded width is kept between events, so that a run of small wheel
+            // movements adds up, rather than each one being rounded away when the columns
+            // are narrow. It starts again from the real width if something else zoomed.
+            if (roundToInt(wheelZoomColW) != getTargetColWidth())
+                wheelZoomColW = getTargetColWidth();
+
+            wheelZoomColW = jlimit((double) range.getStart(), (double) range.getEnd(),
+                                   wheelZoomColW * std::pow(2.0, wheel.deltaY * 2.0));
+
+            const auto newColW = roundToInt(wheelZoomColW);
+
+            if (newColW != getTargetColWidth())
+                owner.zoomToColWidth(newColW, e.getEventRelativeTo(&owner).x, !wheel.isInertial, 120);
+
+            return;
+        }
+
+        Viewport::mouseWheelMove(e, wheel);
+    }
+
+    bool keyPressed(const KeyPress &key) override {
+        if (Viewport::respondsToKey(key)) {
+            const int allowableMods = owner.multipleSelection ? ModifierKeys::shiftModifier : 0;
+
+            if ((key.getModifiers().getRawFlags() & ~allowableMods) == 0) {
+                // we want to avoid these keypresses going to the viewport, and instead allow
+                // them to pass up to our listbox..
+                return false;
+            }
+        }
+
+        return Viewport::keyPressed(key);
+    }
+
+private:
+    HorizontalListBox &owner;
+    std::vector<std::unique_ptr<ColumnComponent>> cols, spareCols;
+    std::unordered_map<int64, ColumnComponent *> componentsByItem; // only used while updating the contents
+    RefreshScheduler refresher{owner};
+    int firstIndex = 0, firstWholeIndex = 0, lastWholeIndex = 0, largestVisibleWidth = 0;
+    int lastNotifiedX = 0, lastNotifiedColW = 0, lastNotifiedH = 0;
+    Range<int> lastVisibleCols, lastColsToPrefetch;
+    double exactX = 0, animationStartX = 0, animationTargetX = 0, animationStartTime = 0;
+    double zoomScale = 1.0, zoomPivotX = 0, zoomStartColW = 0, zoomStartTime = 0, wheelZoomColW = 0;
+    int animationDurationMs = 0, zoomTargetColW = 0, zoomDurationMs = 0;
+    bool hasUpdated = false, isSettingExactPosition = false;
+    bool isAnimatingScroll = false, isZooming = false, isZoomLayout = false, isWaitingToSnap = false;
+    bool hasCarouselTransforms = false;
+
+    static void takeOverComponentForItem(ColumnComponent &colComp, const int64 id,
+                                         std::unordered_map<int64, ColumnComponent *> &componentsByItem) {
+        auto found = componentsByItem.find(id);
+
+        if (id < 0 || found == componentsByItem.end() || found->second == &colComp)
+            return;
+
+        auto &holder = *found->second;
+        colComp.swapCustomComponents(holder);
+        found->second = &colComp;
+
+        if (holder.customComponent != nullptr && holder.refreshedItemId >= 0)
+            componentsByItem[holder.refreshedItemId] = &holder;
+    }
+
+    // Columns that aren't needed any more are kept, with their custom components, as
+    // hidden spares rather than deleted, so that resizing the list back and forth
+    // doesn't keep creating and deleting them. Enough are kept to fill the list at the
+    // widest it's been with the current column width, however narrow the columns are,
+    // but the extra ones left over from zooming out aren't.
+
+    std::unique_ptr<ColumnComponent> obtainCol() {
+        if (spareCols.empty()) {
+            std::unique_ptr<ColumnComponent> newColumn(new ColumnComponent(owner));
+            getViewedComponent()->addAndMakeVisible(newColumn.get());
+            return newColumn;
+        }
+
+        auto colComp = std::move(spareCols.back());
+        spareCols.pop_back();
+        colComp->setVisible(true);
+        return colComp;
+    }
+
+    void releaseCol(std::unique_ptr<ColumnComponent> colComp, const int maxPooledCols) {
+        if ((int) (cols.size() + spareCols.size()) > maxPooledCols)
+            return;
+
+        colComp->setVisible(false);
+        spareCols.push_back(std::move(colComp));
+    }
+
+    void applyFractionalOffset() {
+        const auto fraction = (float) (exactX - getViewPositionX());
+        auto transform = AffineTransform::translation(-fraction, 0.0f);
+
+        if (zoomScale != 1.0)
+            transform = transform.scaled((float) zoomScale, 1.0f, (float) zoomPivotX, 0.0f);
+
+        getViewedComponent()->setTransform(transform);
+    }
+
+    void positionMoved() {
+        if (isZoomLayout)
+            owner.scrollSpeedTracker->setPosition(exactX);
+        else
+            owner.scrollSpeedTracker->positionChanged(exactX);
+
+        updateCarouselTransforms();
+    }
+
+    // Lays the columns out at a new width, scrolled so that anchorCol (a position in
+    // columns) is at anchorX in the viewport, or as near as it can get.
+    void layOutForZoom(const int newColW, const double anchorCol, const double anchorX) {
+        const ScopedValueSetter<bool> svs(isZoomLayout, true);
+
+        if (newColW != owner.colWidth) {
+            const ScopedValueSetter<bool> svs2(isSettingExactPosition, true);
+            owner.setColWidth(newColW);
+        }
+
+        setExactViewPositionX(anchorCol * newColW - anchorX);
+
+        // if the position had to be clamped, the scaling happens around wherever the anchor ended up
+        zoomPivotX = anchorCol * newColW - exactX;
+        applyFractionalOffset();
+    }
+
+    void stopTimerIfIdle() {
+        if (!isAnimatingScroll && !isZooming && !isWaitingToSnap)
+            stopTimer();
+    }
+
+    // eases out, so that animations glide to a stop
+    static double ease(const double progress) noexcept { return 1.0 - std::pow(1.0 - progress, 3.0); }
+
+    void timerCallback() override {
+        const auto now = Time::getMillisecondCounterHiRes();
+
+        if (isZooming) {
+            const auto progress = jmin(1.0, (now - zoomStartTime) / zoomDurationMs);
+
+            if (progress >= 1.0) {
+                finishZoom();
+            } else {
+                zoomScale = (zoomStartColW + (zoomTargetColW - zoomStartColW) * ease(progress)) / owner.colWidth;
+                applyFractionalOffset();
+            }
+        }
+
+        if (isWaitingToSnap && !ModifierKeys::getCurrentModifiersRealtime().isAnyMouseButtonDown()) {
+            isWaitingToSnap = false;
+            snapToFocusedCol();
+        }
+
+        if (isAnimatingScroll) {
+            const auto progress = jmin(1.0, (now - animationStartTime) / animationDurationMs);
+
+            if (progress >= 1.0)
+                isAnimatingScroll = false;
+
+            setExactViewPositionX(animationStartX + (animationTargetX - animationStartX) * ease(progress));
+        }
+
+        stopTimerIfIdle();
+    }
+
+    // tells the model which columns are on screen, and which ones are next to come on
+    // screen in the direction we're scrolling, so that it can get them ready in advance
+    void notifyVisibleColsChanged(const int x, const int colW, const int h) {
+        if (owner.extendedModel == nullptr)
+            return;
+
+        const auto allCols = Range<int>(0, owner.totalItems);
+        const auto visibleCols = Range<int>(x / colW, (x + getMaximumVisibleWidth() + colW - 1) / colW)
+                .getIntersectionWith(allCols);
+        const auto numToPrefetch = jmax(1, visibleCols.getLength());
+
+        const auto colsToPrefetch = (x < lastNotifiedX
+                                     ? Range<int>(visibleCols.getStart() - numToPrefetch, visibleCols.getStart())
+                                     : Range<int>(visibleCols.getEnd(), visibleCols.getEnd() + numToPrefetch))
+                .getIntersectionWith(allCols);
+
+        const bool sizeChanged = colW != lastNotifiedColW || h != lastNotifiedH;
+        lastNotifiedX = x;
+
+        if (sizeChanged || visibleCols != lastVisibleCols || colsToPrefetch != lastColsToPrefetch) {
+            lastNotifiedColW = colW;
+            lastNotifiedH = h;
+            lastVisibleCols = visibleCols;
+            lastColsToPrefetch = colsToPrefetch;
+
+            timeModelCall(owner.callStats.get(), Callback::visibleColsChanged, -1, [&] {
+                owner.extendedModel->visibleColsChanged(visibleCols, colsToPrefetch, colW, h);
+            });
+        }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListViewport)
+};
+
+//==============================================================================
+// Holds back selection changes from high-rate input (mouse moves, key repeat) so that
+// the list updates and tells its model about them at most once per frame. The first
+// change after a quiet period is applied straight away; later ones just replace the
+// pending target until the frame is up.
+class HorizontalListBox::SelectionCoalescer : private Timer {
+public:
+    SelectionCoalescer(HorizontalListBox &lb) : owner(lb) {}
+
+    void selectCol(const int col, const bool dontScroll) {
+        pendingCol = col;
+        pendingDontScroll = dontScroll;
+        hasPending = true;
+
+        const auto sinceLastUpdate = Time::getMillisecondCounterHiRes() - lastUpdateTime;
+
+        if (sinceLastUpdate >= frameIntervalMs)
+            flush();
+        else if (!isTimerRunning())
+            startTimer(jmax(1, roundToInt(frameIntervalMs - sinceLastUpdate)));
+    }
+
+    // relative moves (e.g. the next column) have to start from where the last one was going
+    int getTargetCol(const int currentCol) const noexcept {
+        return hasPending ? pendingCol : currentCol;
+    }
+
+    void flush() {
+        stopTimer();
+
+        if (hasPending) {
+            hasPending = false;
+            lastUpdateTime = Time::getMillisecondCounterHiRes();
+            owner.selectColInternal(pendingCol, pendingDontScroll, true, false);
+        }
+    }
+
+    void cancel() {
+        stopTimer();
+        hasPending = false;
+    }
+
+private:
+    void timerCallback() override {
+        flush();
+    }
+
+    static constexpr double frameIntervalMs = 1000.0 / 60.0;
+
+    HorizontalListBox &owner;
+    double lastUpdateTime = 0;
+    int pendingCol = -1;
+    bool hasPending = false, pendingDontScroll = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SelectionCoalescer)
+};
+
+//==============================================================================
+struct ListBoxMouseMoveSelector : public MouseListener {
+    ListBoxMouseMoveSelector(HorizontalListBox &lb) : owner(lb) {
+        owner.addMouseListener(this, true);
+    }
+
+    ~ListBoxMouseMoveSelector() override {
+        owner.removeMouseListener(this);
+    }
+
+    void mouseMove(const MouseEvent &e) override {
+        auto pos = e.getEventRelativeTo(&owner).position;
+        const auto colW = owner.getColWidth();
+        const auto contentX = owner.getScrollPositionX() + pos.x - owner.getViewport()->getX();
+
+        // most moves stay inside the column that's already under the mouse, and there's
+        // nothing to do for those
+        if (lastCol >= 0 && colW == lastColWidth && isPositiveAndBelow(pos.y, (float) owner.getHeight())
+            && contentX >= lastCol * colW && contentX < (lastCol + 1) * colW)
+            return;
+
+        lastCol = owner.getColContainingPosition(roundToInt(pos.x), roundToInt(pos.y));
+        lastColWidth = colW;
+        owner.selectionCoalescer->selectCol(lastCol, true);
+    }
+
+    void mouseExit(const MouseEvent &e) override {
+        lastCol = -1;
+        mouseMove(e);
+    }
+
+    HorizontalListBox &owner;
+    int lastCol = -1, lastColWidth = 0;
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListBoxMouseMoveSelector)
+};
+
+
+//==============================================================================
+HorizontalListBox::HorizontalListBox(const String &name, ListBoxModel *const m)
+        : Component(name), model(m), extendedModel(dynamic_cast<HorizontalListBoxModel *>(m)) {
+    scrollSpeedTracker.reset(new ScrollSpeedTracker(*this));
+    selectionCoalescer.reset(new SelectionCoalescer(*this));
+    viewport.reset(new ListViewport(*this));
+    addAndMakeVisible(viewport.get());
+
+    HorizontalListBox::setWantsKeyboardFocus(true);
+    HorizontalListBox::colourChanged();
+}
+
+HorizontalListBox::~HorizontalListBox() {
+    textSearch.reset();
+    headerComponent.reset();
+    viewport.reset();
+    selectionCoalescer.reset();
+    scrollSpeedTracker.reset();
+}
+
+void HorizontalListBox::setModel(ListBoxModel *const newModel) {
+    if (model != newModel) {
+        // this waits for any search workers that are still calling the old model
+        textSearch.reset();
+        selectionCoalescer->cancel();
+
+        model = newModel;
+        extendedModel = dynamic_cast<HorizontalListBoxModel *>(newModel);
+
+        // the old model's IDs mean nothing to the new one
+        itemIds.clear();
+        itemIdsValid = false;
+        repaint();
+        updateContent();
+    }
+}
+
+void HorizontalListBox::setMultipleSelectionEnabled(bool b) noexcept { multipleSelection = b; }
+
+void HorizontalListBox::setClickingTogglesColumnSelection(bool b) noexcept { alwaysFlipSelection = b; }
+
+void HorizontalListBox::setColumnSelectedOnMouseDown(bool b) noexcept { selectOnMouseDown = b; }
+
+void HorizontalListBox::setMouseMoveSelectsColumns(bool b) {
+    if (b) {
+        if (mouseMoveSelector == nullptr)
+            mouseMoveSelector.reset(new ListBoxMouseMoveSelector(*this));
+    } else {
+        mouseMoveSelector.reset();
+    }
+}
+
+//==============================================================================
+void HorizontalListBox::paint(Graphics &g) {
+    if (!hasDoneInitialUpdate)
+        updateContent();
+
+    g.fillAll(findColour(backgroundColourId));
+}
+
+// Calls back with the areas of the list that the columns in view from a set are drawn in,
+// after the viewport's content has been shifted by the part-pixel scroll offset and
+// scaled by any zoom. In carousel mode, each column is also scaled about its own
+// centre, so they're done one at a time, through their components' transforms.
+template <typename Callback>
+void HorizontalListBox::forEachDrawnColArea(const IntervalSet &cols, Callback &&callback) const {
+    auto *content = viewport->getViewedComponent();
+    const auto colW = jmax(1, colWidth);
+    const auto firstCol = (int) std::floor(viewport->getContentX(0) / colW);
+    const auto lastCol = (int) std::ceil(viewport->getContentX(viewport->getMaximumVisibleWidth()) / colW);
+    const auto visibleCols = Range<int>(jmax(0, firstCol), jmax(0, lastCol + 1));
+
+    auto areaOf = [this](const Component *comp, const Rectangle<float> r) {
+        return Rectangle<float>(getLocalPoint(comp, r.getTopLeft()), getLocalPoint(comp, r.getBottomRight()));
+    };
+
+    for (auto &r : cols.getOverlappingRanges(visibleCols)) {
+        const auto drawn = r.getIntersectionWith(visibleCols);
+
+        if (carouselMode) {
+            for (auto col = drawn.getStart(); col < drawn.getEnd(); ++col)
+                if (auto *colComp = viewport->getComponentForColIfOnscreen(col))
+                    callback(areaOf(colComp, colComp->getLocalBounds().toFloat()));
+        } else {
+            callback(areaOf(content, {(float) (drawn.getStart() * colW), 0.0f,
+                                      (float) (drawn.getLength() * colW), (float) content->getHeight()}));
+        }
+    }
+}
+
+void HorizontalListBox::paintOverChildren(Graphics &g) {
+    if (textSearch != nullptr && !textSearch->getMatches().isEmpty()) {
+        g.saveState();
+        g.reduceClipRegion(viewport->getBounds());
+        g.setColour(isColourSpecified(searchHighlightColourId) || getLookAndFeel().isColourSpecified(searchHighlightColourId)
+                    ? findColour(searchHighlightColourId)
+                    : getLookAndFeel().findColour(TextEditor::highlightColourId));
+
+        forEachDrawnColArea(textSearch->getMatches(), [&g](const Rectangle<float> area) { g.fillRect(area); });
+        g.restoreState();
+    }
+
+    if (outlineThickness > 0) {
+        g.setColour(findColour(outlineColourId));
+        g.drawRect(getLocalBounds(), outlineThickness);
+    }
+}
+
+void HorizontalListBox::resized() {
+    viewport->setBoundsInset(
+            BorderSize<int>(outlineThickness,
+                            outlineThickness + (headerComponent != nullptr ? headerComponent->getWidth() : 0),
+                            outlineThickness, outlineThickness));
+
+    viewport->setSingleStepSizes(getColWidth(), 20);
+
+    viewport->updateVisibleArea(false);
+}
+
+void HorizontalListBox::visibilityChanged() {
+    viewport->updateVisibleArea(true);
+}
+
+Viewport *HorizontalListBox::getViewport() const noexcept {
+    return viewport.get();
+}
+
+//==============================================================================
+void HorizontalListBox::updateContent() {
+    updateContentWithoutNotifying();
+    listeners.call([this](Listener &l) { l.listContentUpdated(*this, totalItems); });
+}
+
+// Does the work of updateContent(), for the methods that tell the listeners what's
+// changed themselves.
+void HorizontalListBox::updateContentWithoutNotifying() {
+    HORIZONTAL_LIST_TRACE_SCOPE(tracer, "updateContent", -1);
+    hasDoneInitialUpdate = true;
+    const auto oldTotalItems = totalItems;
+    totalItems = (model != nullptr)
+                 ? timeModelCall(callStats.get(), Callback::getNumRows, -1, [this] { return model->getNumRows(); })
+                 : 0;
+
+    bool selectionChanged = false;
+    const auto itemsFollowed = comparingItemIds && followItemIds(selectionChanged);
+
+    // without IDs, there's no telling which of the items are still the same
+    if (comparingItemIds && !itemsFollowed) {
+        if (auto *cache = getCacheForPainting())
+            cache->invalidateAll(model);
+
+        viewport->itemsChangedIn({0, std::numeric_limits<int>::max()});
+        updateItemIds();
+        refreshSearch();
+    } else if (!itemsFollowed) {
+        updateItemIds();
+
+        // the items that are left are assumed to be the ones that were there before
+        if (totalItems < oldTotalItems)
+            indexedItemsChanged({totalItems, oldTotalItems});
+
+        if (textSearch != nullptr) {
+            if (totalItems < oldTotalItems)
+                textSearch->trimToSize(totalItems);
+            else if (totalItems > oldTotalItems)
+                textSearch->scanMore({oldTotalItems, totalItems});
+        }
+    }
+
+    if (selected.getTotalRange().getEnd() > totalItems) {
+        selected.removeRange({totalItems, std::numeric_limits<int>::max()});
+        lastColSelected = getSelectedCol(0);
+        selectionChanged = true;
+    }
+
+    viewport->updateVisibleArea(isVisible());
+    viewport->resized();
+
+    if (followingTail)
+        scrollToTail();
+
+    if (selectionChanged && model != nullptr)
+        notifyModelOfSelectionChange(lastColSelected);
+}
+
+void HorizontalListBox::allColsChanged() {
+    {
+        const ScopedValueSetter<bool> svs(comparingItemIds, true);
+        updateContentWithoutNotifying();
+    }
+
+    listeners.call([this](Listener &l) { l.listAllColsChanged(*this, totalItems); });
+}
+
+void HorizontalListBox::colsRemovedFromStart(const int numRemoved) {
+    if (numRemoved <= 0)
+        return;
+
+    const auto removed = Range<int>(0, numRemoved);
+    selectionCoalescer->cancel();
+
+    if (hasItemIds())
+        removeItemIds(removed);
+    else
+        indexedItemsChanged({0, totalItems});
+
+    if (textSearch != nullptr)
+        textSearch->removeCols(removed);
+
+    selected.removeAndShift(removed);
+    lastColSelected = lastColSelected >= numRemoved ? lastColSelected - numRemoved : getSelectedCol(0);
+    totalItems = jmax(0, totalItems - numRemoved);
+
+    // every remaining item's index has gone down, so any column that keeps its index, e.g.
+    // because the list is following the tail or is scrolled to the start, shows a new item
+    viewport->itemsChangedIn({0, std::numeric_limits<int>::max()});
+
+    if (!followingTail) {
+        const ScopedValueSetter<bool> svs(isScrollingToTail, true);
+        viewport->setExactViewPositionX(viewport->getExactViewPositionX() - numRemoved * colWidth);
+    }
+
+    viewport->updateContents();
+
+    listeners.call([this, numRemoved](Listener &l) { l.listColsRemovedFromStart(*this, numRemoved); });
+}
+
+void HorizontalListBox::colsInserted(const int startIndex, const int numInserted) {
+    if (numInserted <= 0)
+        return;
+
+    const auto inserted = Range<int>::withStartAndLength(jlimit(0, totalItems, startIndex), numInserted);
+    selectionCoalescer->cancel();
+
+    if (textSearch != nullptr)
+        textSearch->insertCols(inserted);
+
+    selected.insertAndShift(inserted);
+
+    if (lastColSelected >= inserted.getStart())
+        lastColSelected += numInserted;
+
+    if (hasItemIds())
+        insertItemIds(inserted);
+    else
+        indexedItemsChanged({inserted.getStart(), totalItems + numInserted});
+
+    // this stops updateContent() from thinking the new columns were appended
+    totalItems += numInserted;
+    updateContentWithoutNotifying();
+
+    keepColsInViewAfterShift(inserted.getStart(), numInserted);
+
+    listeners.call([&](Listener &l) { l.listColsInserted(*this, inserted.getStart(), numInserted); });
+}
+
+void HorizontalListBox::colsRemoved(const int startIndex, const int numRemoved) {
+    const auto removed = Range<int>::withStartAndLength(startIndex, jmax(0, numRemoved))
+            .getIntersectionWith({0, totalItems});
+
+    if (removed.isEmpty())
+        return;
+
+    selectionCoalescer->cancel();
+
+    if (textSearch != nullptr)
+        textSearch->removeCols(removed);
+
+    const auto selectionChanged = selected.overlapsRange(removed);
+    selected.removeAndShift(removed);
+
+    if (lastColSelected >= removed.getEnd())
+        lastColSelected -= removed.getLength();
+    else if (lastColSelected >= removed.getStart())
+        lastColSelected = getSelectedCol(0);
+
+    keepColsInViewAfterShift(removed.getStart(), -removed.getLength());
+
+    if (hasItemIds())
+        removeItemIds(removed);
+    else
+        indexedItemsChanged({removed.getStart(), totalItems});
+
+    totalItems -= removed.getLength();
+    updateContentWithoutNotifying();
+
+    if (selectionChanged && model != nullptr)
+        notifyModelOfSelectionChange(lastColSelected);
+
+    listeners.call([&](Listener &l) { l.listColsRemoved(*this, removed.getStart(), removed.getLength()); });
+}
+
+void HorizontalListBox::colMoved(const int oldIndex, const int newIndex) {
+    if (oldIndex == newIndex || !isPositiveAndBelow(oldIndex, totalItems) || !isPositiveAndBelow(newIndex, totalItems))
+        return;
+
+    selectionCoalescer->cancel();
+
+    const auto wasSelected = selected.contains(oldIndex);
+    selected.removeAndShift({oldIndex, oldIndex + 1});
+    selected.insertAndShift({newIndex, newIndex + 1});
+
+    if (wasSelected)
+        selected.addRange({newIndex, newIndex + 1});
+
+    if (lastColSelected == oldIndex)
+        lastColSelected = newIndex;
+    else if (oldIndex < lastColSelected && lastColSelected <= newIndex)
+        --lastColSelected;
+    else if (newIndex <= lastColSelected && lastColSelected < oldIndex)
+        ++lastColSelected;
+
+    // a move is rare enough that it's not worth moving the matches about
+    if (textSearch != nullptr)
+        textSearch->restart(totalItems);
+
+    if (hasItemIds() && (int) itemIds.size() == totalItems) {
+        const auto id = itemIds[(size_t) oldIndex];
+        itemIds.erase(itemIds.begin() + oldIndex);
+        itemIds.insert(itemIds.begin() + newIndex, id);
+    } else {
+        indexedItemsChanged({jmin(oldIndex, newIndex), jmax(oldIndex, newIndex) + 1});
+    }
+
+    updateContentWithoutNotifying();
+
+    listeners.call([=](Listener &l) { l.listColMoved(*this, oldIndex, newIndex); });
+}
+
+void HorizontalListBox::colChanged(const int col) {
+    if (!isPositiveAndBelow(col, totalItems))
+        return;
 
-            if ((key.getModifiers().getRawFlags() & ~allowableMods) == 0) {
-                // we want to avoid these keypresses going to the viewport, and instead allow
-                // them to pass up to our listbox..
-                return false;
-            }
-        }
+    if (auto *cache = getCacheForPainting())
+        cache->invalidate(model, getCacheKeyForCol(col));
 
-        return Viewport::keyPressed(key);
-    }
+    if (textSearch != nullptr)
+        textSearch->rescanCols({col, col + 1});
 
-private:
-    HorizontalListBox &owner;
-    OwnedArray<ColumnComponent> cols;
-    int firstIndex = 0, firstWholeIndex = 0, lastWholeIndex = 0;
-    bool hasUpdated = false;
+    viewport->refreshCol(col, selected.contains(col));
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListViewport)
-};
+    listeners.call([=](Listener &l) { l.listColChanged(*this, col); });
+}
 
-//==============================================================================
-struct ListBoxMouseMoveSelector : public MouseListener {
-    ListBoxMouseMoveSelector(HorizontalListBox &lb) : owner(lb) {
-        owner.addMouseListener(this, true);
-    }
+void HorizontalListBox::colsChanged(const IntervalSet &cols) {
+    if (cols.isEmpty())
+        return;
 
-    ~ListBoxMouseMoveSelector() override {
-        owner.removeMouseListener(this);
-    }
+    if (auto *cache = getCacheForPainting()) {
+        std::vector<int64> keys;
 
-    void mouseMove(const MouseEvent &e) override {
-        auto pos = e.getEventRelativeTo(&owner).position.toInt();
-        owner.selectColumn(owner.getColContainingPosition(pos.x, pos.y), true);
-    }
+        for (auto &r : cols.getOverlappingRanges({0, totalItems}))
+            for (auto i = jmax(0, r.getStart()); i < jmin(totalItems, r.getEnd()); ++i)
+                keys.push_back(getCacheKeyForCol(i));
 
-    void mouseExit(const MouseEvent &e) override {
-        mouseMove(e);
+        std::sort(keys.begin(), keys.end());
+        cache->invalidateIf(model, [&keys](int64 key) { return std::binary_search(keys.begin(), keys.end(), key); });
     }
 
-    HorizontalListBox &owner;
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListBoxMouseMoveSelector)
-};
+    if (textSearch != nullptr)
+        for (auto &r : cols.getOverlappingRanges({0, totalItems}))
+            textSearch->rescanCols(r);
 
+    const auto firstCol = viewport->getViewPositionX() / colWidth;
 
-//==============================================================================
-HorizontalListBox::HorizontalListBox(const String &name, ListBoxModel *const m)
-        : Component(name), model(m) {
-    viewport.reset(new ListViewport(*this));
-    addAndMakeVisible(viewport.get());
+    for (auto &r : cols.getOverlappingRanges({firstCol, firstCol + getNumColsOnScreen() + 2}))
+        for (auto i = r.getStart(); i < r.getEnd(); ++i)
+            viewport->refreshCol(i, selected.contains(i));
 
-    HorizontalListBox::setWantsKeyboardFocus(true);
-    HorizontalListBox::colourChanged();
+    listeners.call([&](Listener &l) { l.listColsChanged(*this, cols); });
 }
 
-HorizontalListBox::~HorizontalListBox() {
-    headerComponent.reset();
-    viewport.reset();
+int64 HorizontalListBox::getItemIdForCol(const int col) const noexcept {
+    return isPositiveAndBelow(col, (int) itemIds.size()) ? itemIds[(size_t) col] : -1;
 }
 
-void HorizontalListBox::setModel(ListBoxModel *const newModel) {
-    if (model != newModel) {
-        model = newModel;
-        repaint();
-        updateContent();
-    }
+int64 HorizontalListBox::getCacheKeyForCol(const int col) const noexcept {
+    const auto id = getItemIdForCol(col);
+    return id >= 0 ? id : col;
 }
 
-void HorizontalListBox::setMultipleSelectionEnabled(bool b) noexcept { multipleSelection = b; }
+bool HorizontalListBox::hasItemIds() const noexcept {
+    return itemIdsValid && !itemIds.empty();
+}
 
-void HorizontalListBox::setClickingTogglesColumnSelection(bool b) noexcept { alwaysFlipSelection = b; }
+// Keeps the item IDs in step with the model when columns have only been added to or
+// removed from the end, so an update only asks the model for the IDs of new columns.
+void HorizontalListBox::updateItemIds() {
+    const auto numIds = (int) itemIds.size();
 
-void HorizontalListBox::setColumnSelectedOnMouseDown(bool b) noexcept { selectOnMouseDown = b; }
+    // the items that were there before should still be where they were - if the model has
+    // reordered them, call allColsChanged() rather than updateContent()
+    jassert (!itemIdsValid || numIds == 0 || totalItems == 0
+             || (extendedModel->getItemId(0) == itemIds.front()
+                 && extendedModel->getItemId(jmin(numIds, totalItems) - 1) == itemIds[(size_t) jmin(numIds, totalItems) - 1]));
 
-void HorizontalListBox::setMouseMoveSelectsColumns(bool b) {
-    if (b) {
-        if (mouseMoveSelector == nullptr)
-            mouseMoveSelector.reset(new ListBoxMouseMoveSelector(*this));
-    } else {
-        mouseMoveSelector.reset();
+    if (itemIdsValid && numIds >= totalItems) {
+        removeItemIds({totalItems, numIds});
+        return;
     }
-}
 
-//==============================================================================
-void HorizontalListBox::paint(Graphics &g) {
-    if (!hasDoneInitialUpdate)
-        updateContent();
+    if (!itemIdsValid)
+        itemIds.clear();
 
-    g.fillAll(findColour(backgroundColourId));
+    const auto modelHasIds = extendedModel != nullptr && totalItems > 0 && extendedModel->getItemId(0) >= 0;
+    itemIdsValid = modelHasIds || totalItems == 0;
+
+    if (modelHasIds)
+        insertItemIds({(int) itemIds.size(), totalItems});
+    else
+        itemIds.clear();
 }
 
-void HorizontalListBox::paintOverChildren(Graphics &g) {
-    if (outlineThickness > 0) {
-        g.setColour(findColour(outlineColourId));
-        g.drawRect(getLocalBounds(), outlineThickness);
+// Gets all of the model's item IDs and compares them with the ones from the last
+// update, so that the selection, search matches and custom components follow the
+// items. Only the part between the first and last IDs that have changed is looked
+// at. Returns false if the model doesn't have IDs, or if there aren't any earlier
+// ones to compare with.
+bool HorizontalListBox::followItemIds(bool &selectionChanged) {
+    std::vector<int64> newIds;
+    const auto modelHasIds = extendedModel != nullptr && totalItems > 0 && extendedModel->getItemId(0) >= 0;
+
+    if (modelHasIds) {
+        newIds.reserve((size_t) totalItems);
+
+        for (int i = 0; i < totalItems; ++i)
+            newIds.push_back(extendedModel->getItemId(i));
     }
-}
 
-void HorizontalListBox::resized() {
-    viewport->setBoundsInset(
-            BorderSize<int>(outlineThickness,
-                            outlineThickness + (headerComponent != nullptr ? headerComponent->getWidth() : 0),
-                            outlineThickness, outlineThickness));
+    const auto canFollow = modelHasIds && itemIdsValid;
+    itemIdsValid = modelHasIds || totalItems == 0;
+    itemIds.swap(newIds);
 
-    viewport->setSingleStepSizes(getColWidth(), 20);
+    if (!canFollow)
+        return false;
 
-    viewport->updateVisibleArea(false);
+    const auto &oldIds = newIds;
+    const auto oldSize = oldIds.size(), newSize = itemIds.size();
+    size_t prefix = 0, suffix = 0;
+
+    while (prefix < jmin(oldSize, newSize) && oldIds[prefix] == itemIds[prefix])
+        ++prefix;
+
+    while (suffix < jmin(oldSize, newSize) - prefix && oldIds[oldSize - 1 - suffix] == itemIds[newSize - 1 - suffix])
+        ++suffix;
+
+    const auto oldChanged = Range<int>((int) prefix, (int) (oldSize - suffix));
+    const auto newChanged = Range<int>((int) prefix, (int) (newSize - suffix));
+
+    if (oldChanged.isEmpty() && newChanged.isEmpty())
+        return true;
+
+    std::unordered_map<int64, int> newIndexes;
+
+    for (auto i = newChanged.getStart(); i < newChanged.getEnd(); ++i)
+        newIndexes[itemIds[(size_t) i]] = i;
+
+    auto findNewIndex = [&](const int oldIndex) {
+        auto found = newIndexes.find(oldIds[(size_t) oldIndex]);
+        return found != newIndexes.end() ? found->second : -1;
+    };
+
+    // the selected items in the changed part are moved to wherever they are now
+    IntervalSet movedSelection;
+
+    for (auto &r : selected.getOverlappingRanges(oldChanged)) {
+        const auto overlap = r.getIntersectionWith(oldChanged);
+
+        for (auto i = overlap.getStart(); i < overlap.getEnd(); ++i) {
+            const auto newIndex = findNewIndex(i);
+
+            if (newIndex >= 0)
+                movedSelection.addRange({newIndex, newIndex + 1});
+            else
+                selectionChanged = true;
+        }
+    }
+
+    const auto lastColSelectedWasMoved = oldChanged.contains(lastColSelected);
+    const auto lastColSelectedNewIndex = lastColSelectedWasMoved ? findNewIndex(lastColSelected) : -1;
+
+    selected.removeAndShift(oldChanged);
+    selected.insertAndShift(newChanged);
+    selected.addSet(movedSelection);
+
+    if (lastColSelectedWasMoved)
+        lastColSelected = lastColSelectedNewIndex >= 0 ? lastColSelectedNewIndex : getSelectedCol(0);
+    else if (lastColSelected >= oldChanged.getEnd())
+        lastColSelected += newChanged.getLength() - oldChanged.getLength();
+
+    // images are cached by ID, so only those of items that have gone are thrown away; the
+    // columns that are now showing different items notice their IDs have changed and
+    // repaint themselves, and the ones showing items that have moved take over the items'
+    // custom components (see updateContents())
+    if (auto *cache = getCacheForPainting()) {
+        std::vector<int64> goneIds;
+
+        for (auto i = oldChanged.getStart(); i < oldChanged.getEnd(); ++i)
+            if (findNewIndex(i) < 0)
+                goneIds.push_back(oldIds[(size_t) i]);
+
+        if (!goneIds.empty()) {
+            std::sort(goneIds.begin(), goneIds.end());
+            cache->invalidateIf(model, [&goneIds](int64 id) {
+                return std::binary_search(goneIds.begin(), goneIds.end(), id);
+            });
+        }
+    }
+
+    if (textSearch != nullptr)
+        textSearch->replaceCols(oldChanged, newChanged);
+
+    itemsReordered = true;
+    return true;
 }
 
-void HorizontalListBox::visibilityChanged() {
-    viewport->updateVisibleArea(true);
+void HorizontalListBox::insertItemIds(const Range<int> cols) {
+    std::vector<int64> newIds;
+    newIds.reserve((size_t) cols.getLength());
+
+    for (auto i = cols.getStart(); i < cols.getEnd(); ++i)
+        newIds.push_back(extendedModel->getItemId(i));
+
+    itemIds.insert(itemIds.begin() + jmin(cols.getStart(), (int) itemIds.size()), newIds.begin(), newIds.end());
 }
 
-Viewport *HorizontalListBox::getViewport() const noexcept {
-    return viewport.get();
+void HorizontalListBox::removeItemIds(const Range<int> cols) {
+    const auto toRemove = cols.getIntersectionWith({0, (int) itemIds.size()});
+    itemIds.erase(itemIds.begin() + toRemove.getStart(), itemIds.begin() + toRemove.getEnd());
 }
 
-//==============================================================================
-void HorizontalListBox::updateContent() {
-    hasDoneInitialUpdate = true;
-    totalItems = (model != nullptr) ? model->getNumRows() : 0;
+void HorizontalListBox::keepColsInViewAfterShift(const int firstChangedCol, const int numColsShifted) {
+    if (followingTail)
+        return;
 
-    bool selectionChanged = false;
+    const auto x = viewport->getExactViewPositionX();
 
-    if (selected.size() > 0 && selected[selected.size() - 1] >= totalItems) {
-        selected.removeRange({totalItems, std::numeric_limits<int>::max()});
-        lastColSelected = getSelectedCol(0);
-        selectionChanged = true;
+    // only the columns that were wholly before the view move it, so removing the columns
+    // that are in view doesn't pull the ones before them in
+    const auto numBefore = numColsShifted > 0
+                           ? (firstChangedCol * colWidth < x ? numColsShifted : 0)
+                           : -jlimit(0, -numColsShifted, (int) (x / jmax(1, colWidth)) - firstChangedCol);
+
+    if (numBefore != 0) {
+        const ScopedValueSetter<bool> svs(isScrollingToTail, true);
+        viewport->setExactViewPositionX(x + numBefore * colWidth);
     }
+}
 
-    viewport->updateVisibleArea(isVisible());
-    viewport->resized();
+void HorizontalListBox::setFollowsTail(const bool shouldFollowTail) {
+    followsTail = shouldFollowTail;
+    followingTail = shouldFollowTail;
 
-    if (selectionChanged && model != nullptr)
-        model->selectedRowsChanged(lastColSelected);
+    if (followingTail)
+        scrollToTail();
+}
+
+void HorizontalListBox::scrollToTail() {
+    const ScopedValueSetter<bool> svs(isScrollingToTail, true);
+    viewport->setExactViewPositionX(std::numeric_limits<double>::max());
+}
+
+void HorizontalListBox::updateTailFollowing() {
+    // only the user's own scrolling starts or stops the following
+    if (followsTail && !isScrollingToTail) {
+        const auto maxX = viewport->getViewedComponent()->getWidth() - viewport->getMaximumVisibleWidth();
+        followingTail = viewport->getExactViewPositionX() >= maxX - colWidth / 2;
+    }
 }
 
 //==============================================================================
 void HorizontalListBox::selectColumn(int colNumber, bool dontScrollToShowThisCol, bool deselectOthersFirst) {
+    // a selection that's still waiting from mouse moves or key repeats would undo this one,
+    // so all the public ways of changing the selection throw it away first
+    selectionCoalescer->cancel();
     selectColInternal(colNumber, dontScrollToShowThisCol, deselectOthersFirst, false);
 }
 
@@ -426,7 +1737,7 @@ void HorizontalListBox::selectColInternal(const int col,
                                 lastColSelected, totalItems, isMouseClick);
 
             lastColSelected = col;
-            model->selectedRowsChanged(col);
+            notifyModelOfSelectionChange(col);
         } else {
             if (deselectOthersFirst)
                 deselectAllCols();
@@ -435,6 +1746,8 @@ void HorizontalListBox::selectColInternal(const int col,
 }
 
 void HorizontalListBox::deselectCol(const int col) {
+    selectionCoalescer->cancel();
+
     if (selected.contains(col)) {
         selected.removeRange({col, col + 1});
 
@@ -442,13 +1755,24 @@ void HorizontalListBox::deselectCol(const int col) {
             lastColSelected = getSelectedCol(0);
 
         viewport->updateContents();
-        model->selectedRowsChanged(lastColSelected);
+        notifyModelOfSelectionChange(lastColSelected);
     }
 }
 
 void HorizontalListBox::setSelectedCols(const SparseSet<int> &setOfColumnsToBeSelected,
                                         const NotificationType sendNotificationEventToModel) {
+    setSelectedCols(IntervalSet(setOfColumnsToBeSelected), sendNotificationEventToModel);
+}
+
+void HorizontalListBox::setSelectedCols(const IntervalSet &setOfColumnsToBeSelected,
+                                        const NotificationType sendNotificationEventToModel) {
+    selectionCoalescer->cancel();
+
     selected = setOfColumnsToBeSelected;
+    selectionReplaced(sendNotificationEventToModel);
+}
+
+void HorizontalListBox::selectionReplaced(const NotificationType sendNotificationEventToModel) {
     selected.removeRange({totalItems, std::numeric_limits<int>::max()});
 
     if (!isColSelected(lastColSelected))
@@ -457,14 +1781,78 @@ void HorizontalListBox::setSelectedCols(const SparseSet<int> &setOfColumnsToBeSe
     viewport->updateContents();
 
     if (model != nullptr && sendNotificationEventToModel == sendNotification)
-        model->selectedRowsChanged(lastColSelected);
+        notifyModelOfSelectionChange(lastColSelected);
+}
+
+void HorizontalListBox::selectWhere(const std::function<bool(int)> &predicate,
+                                    const bool addToCurrentSelection,
+                                    const NotificationType sendNotificationEventToModel) {
+    selectionCoalescer->cancel();
+
+    const auto chunkSize = ListWorkerPool::getDefaultChunkSize(totalItems);
+    const auto numChunks = (totalItems + chunkSize - 1) / chunkSize;
+
+    // each chunk collects its matches as runs, so there's one allocation per run at most,
+    // and because the chunks are in order the runs can be appended straight to the result
+    Array<Array<Range<int>>> runsPerChunk;
+    runsPerChunk.resize(numChunks);
+
+    workerPool->parallelFor(totalItems, chunkSize, [&](Range<int> chunk) {
+        auto &runs = runsPerChunk.getReference(chunk.getStart() / chunkSize);
+        auto runStart = -1;
+
+        for (auto col = chunk.getStart(); col < chunk.getEnd(); ++col) {
+            if (predicate(col)) {
+                if (runStart < 0)
+                    runStart = col;
+            } else if (runStart >= 0) {
+                runs.add({runStart, col});
+                runStart = -1;
+            }
+        }
+
+        if (runStart >= 0)
+            runs.add({runStart, chunk.getEnd()});
+    });
+
+    IntervalSet matches;
+
+    for (auto &runs : runsPerChunk)
+        for (auto &run : runs)
+            matches.addRange(run);
+
+    if (!multipleSelection) {
+        // only the first match can be selected
+        if (!matches.isEmpty())
+            matches.removeRange({matches[0] + 1, totalItems});
+    } else if (addToCurrentSelection) {
+        matches.addSet(selected);
+    }
+
+    selected = std::move(matches);
+    selectionReplaced(sendNotificationEventToModel);
+
+    // a single selection jumps to its column, as selectColumn() would
+    if (!multipleSelection && lastColSelected >= 0)
+        scrollToEnsureColIsOnscreen(lastColSelected);
+}
+
+void HorizontalListBox::invertSelection(const NotificationType sendNotificationEventToModel) {
+    selectionCoalescer->cancel();
+
+    if (multipleSelection) {
+        selected = selected.getComplement({0, totalItems});
+        selectionReplaced(sendNotificationEventToModel);
+    }
 }
 
 SparseSet<int> HorizontalListBox::getSelectedCols() const {
-    return selected;
+    return selected.toSparseSet();
 }
 
 void HorizontalListBox::selectRangeOfCols(int firstCol, int lastCol, bool dontScrollToShowThisRange) {
+    selectionCoalescer->cancel();
+
     if (multipleSelection && (firstCol != lastCol)) {
         const int numCols = totalItems - 1;
         firstCol = jlimit(0, jmax(0, numCols), firstCol);
@@ -480,6 +1868,8 @@ void HorizontalListBox::selectRangeOfCols(int firstCol, int lastCol, bool dontSc
 }
 
 void HorizontalListBox::flipColSelection(const int colNumber) {
+    selectionCoalescer->cancel();
+
     if (isColSelected(colNumber))
         deselectCol(colNumber);
     else
@@ -487,6 +1877,8 @@ void HorizontalListBox::flipColSelection(const int colNumber) {
 }
 
 void HorizontalListBox::deselectAllCols() {
+    selectionCoalescer->cancel();
+
     if (!selected.isEmpty()) {
         selected.clear();
         lastColSelected = -1;
@@ -494,13 +1886,16 @@ void HorizontalListBox::deselectAllCols() {
         viewport->updateContents();
 
         if (model != nullptr)
-            model->selectedRowsChanged(lastColSelected);
+            notifyModelOfSelectionChange(lastColSelected);
     }
 }
 
 void HorizontalListBox::selectColsBasedOnModifierKeys(int colThatWasClickedOn,
                                                       ModifierKeys modifiers,
                                                       bool isMouseUpEvent) {
+    // a click replaces anything that's still waiting from mouse moves or key repeats
+    selectionCoalescer->cancel();
+
     if (multipleSelection && (modifiers.isCommandDown() || alwaysFlipSelection)) {
         flipColSelection(colThatWasClickedOn);
     } else if (multipleSelection && modifiers.isShiftDown() && lastColSelected >= 0) {
@@ -528,10 +1923,132 @@ int HorizontalListBox::getLastColumnSelected() const {
     return isColSelected(lastColSelected) ? lastColSelected : -1;
 }
 
+//==============================================================================
+void HorizontalListBox::findText(const String &textToFind, const bool ignoreCase) {
+    if (textToFind.isEmpty() || extendedModel == nullptr) {
+        clearSearch();
+        return;
+    }
+
+    if (textSearch == nullptr) {
+        textSearch.reset(new ColumnTextSearch());
+        textSearch->onMatchesFound = [this](const IntervalSet &found) { repaintColsIn(found); };
+
+        textSearch->onSearchFinished = [this] {
+            if (typeAheadJumpPending) {
+                typeAheadJumpPending = false;
+                selectMatchNear(typeAheadStartCol - 1, true);
+            }
+        };
+    }
+
+    repaintColsIn(textSearch->getMatches());
+
+    auto *m = extendedModel;
+    textSearch->start(textToFind, ignoreCase, totalItems, [m](int col) { return m->getTextForCol(col); });
+}
+
+void HorizontalListBox::clearSearch() {
+    if (textSearch != nullptr) {
+        repaintColsIn(textSearch->getMatches());
+        textSearch->clear();
+    }
+
+    typeAheadText.clear();
+    typeAheadJumpPending = false;
+}
+
+void HorizontalListBox::refreshSearch() {
+    if (textSearch != nullptr) {
+        repaintColsIn(textSearch->getMatches());
+        textSearch->restart(totalItems);
+    }
+}
+
+const IntervalSet &HorizontalListBox::getSearchMatches() const noexcept {
+    static const IntervalSet noMatches;
+    return textSearch != nullptr ? textSearch->getMatches() : noMatches;
+}
+
+bool HorizontalListBox::isSearching() const noexcept {
+    return textSearch != nullptr && textSearch->isSearching();
+}
+
+bool HorizontalListBox::selectNextMatch() {
+    return selectMatchNear(lastColSelected, true);
+}
+
+bool HorizontalListBox::selectPreviousMatch() {
+    return selectMatchNear(lastColSelected < 0 ? totalItems : lastColSelected, false);
+}
+
+bool HorizontalListBox::selectMatchNear(const int col, const bool forwards) {
+    auto &matches = getSearchMatches();
+
+    if (matches.isEmpty())
+        return false;
+
+    int target;
+
+    if (forwards) {
+        if (!matches.findNextValueAfter(col, target))
+            target = matches[0];
+    } else {
+        if (!matches.findPreviousValueBefore(col, target))
+            target = matches.getTotalRange().getEnd() - 1;
+    }
+
+    selectColumn(target, true);
+    scrollToEnsureColIsOnscreen(target);
+    return true;
+}
+
+void HorizontalListBox::setTypeAheadEnabled(const bool shouldBeEnabled) noexcept {
+    typeAheadEnabled = shouldBeEnabled;
+}
+
+void HorizontalListBox::handleTypeAhead(const juce_wchar character) {
+    const auto now = Time::getMillisecondCounter();
+
+    if (now - lastTypeAheadTime > 1000) {
+        typeAheadText.clear();
+        typeAheadStartCol = jmax(0, lastColSelected);
+    }
+
+    lastTypeAheadTime = now;
+    typeAheadText << character;
+    typeAheadJumpPending = true;
+
+    // as the text has only grown, this just re-checks the columns that matched before
+    findText(typeAheadText);
+}
+
+void HorizontalListBox::repaintColsIn(const IntervalSet &cols) {
+    forEachDrawnColArea(cols, [this](const Rectangle<float> area) {
+        repaint(area.getSmallestIntegerContainer().expanded(1, 0));
+    });
+}
+
+void HorizontalListBox::repaintColsWithReducedDetail() {
+    viewport->repaintColsWithReducedDetail();
+}
+
+void HorizontalListBox::setReducedDetailThresholds(const float colsPerSecond, const double paintBudgetMs) {
+    scrollSpeedTracker->setThresholds(colsPerSecond, paintBudgetMs);
+}
+
+void HorizontalListBox::setComponentRefreshBudget(const double millisecondsPerFrame) noexcept {
+    refreshBudgetMs = millisecondsPerFrame;
+}
+
+bool HorizontalListBox::isScrollingFast() const noexcept {
+    return scrollSpeedTracker->getDetailLevel() != HorizontalListBoxModel::DetailLevel::full;
+}
+
 //==============================================================================
 int HorizontalListBox::getColContainingPosition(const int x, const int y) const noexcept {
     if (isPositiveAndBelow(getHeight(), y)) {
-        const int col = (viewport->getViewPositionX() + x - viewport->getX()) / colWidth;
+        const auto col = (int) std::floor(viewport->getContentX(x - viewport->getX()) / colWidth);
 
         if (isPositiveAndBelow(col, totalItems))
             return col;
@@ -548,10 +2065,7 @@ int HorizontalListBox::getInsertionIndexForPosition(const int x, const int y) co
 }
 
 Component *HorizontalListBox::getComponentForColNumber(const int col) const noexcept {
-    if (auto *listColComp = viewport->getComponentForColIfOnscreen(col))
-        return listColComp->customComponent.get();
-
-    return nullptr;
+    return viewport->getCustomComponentForCol(col);
 }
 
 int HorizontalListBox::getColNumberOfComponent(Component *const colComponent) const noexcept {
@@ -571,16 +2085,27 @@ Rectangle<int> HorizontalListBox::getColPosition(int colNumber, bool relativeToC
 void HorizontalListBox::setHorizontalPosition(const double proportion) {
     auto offscreen = viewport->getViewedComponent()->getWidth() - viewport->getWidth();
 
-    viewport->setViewPosition(jmax(0, roundToInt(proportion * offscreen)), viewport->getViewPositionY());
+    viewport->setExactViewPositionX(jmax(0.0, proportion * offscreen));
 }
 
 double HorizontalListBox::getHorizontalPosition() const {
     auto offscreen = viewport->getViewedComponent()->getWidth() - viewport->getWidth();
 
-    return offscreen > 0 ? viewport->getViewPositionX() / (double) offscreen
+    return offscreen > 0 ? viewport->getExactViewPositionX() / (double) offscreen
                          : 0;
 }
 
+void HorizontalListBox::setScrollPositionX(const double newX, const bool animate, const int animationMs) {
+    if (animate)
+        viewport->animateToX(newX, animationMs);
+    else
+        viewport->setExactViewPositionX(newX);
+}
+
+double HorizontalListBox::getScrollPositionX() const noexcept {
+    return viewport->getExactViewPositionX();
+}
+
 int HorizontalListBox::getVisibleColHeight() const noexcept {
     return viewport->getViewHeight();
 }
@@ -597,45 +2122,70 @@ bool HorizontalListBox::keyPressed(const KeyPress &key) {
                           && lastColSelected >= 0
                           && key.getModifiers().isShiftDown();
 
+    const bool isNavigationKey = key.isKeyCode(KeyPress::upKey) || key.isKeyCode(KeyPress::downKey)
+                                 || key.isKeyCode(KeyPress::pageUpKey) || key.isKeyCode(KeyPress::pageDownKey)
+                                 || key.isKeyCode(KeyPress::homeKey) || key.isKeyCode(KeyPress::endKey);
+
+    // plain navigation is coalesced to one selection change per frame, so that holding a key
+    // down doesn't do more work than can be shown; anything else needs to see it applied,
+    // e.g. return and delete act on lastColSelected, which has to be the pending column
+    if (multiple || !isNavigationKey)
+        selectionCoalescer->flush();
+
+    const int currentCol = selectionCoalescer->getTargetCol(lastColSelected);
+
     if (key.isKeyCode(KeyPress::upKey)) {
         if (multiple)
             selectRangeOfCols(lastColSelected, lastColSelected - 1);
         else
-            selectColumn(jmax(0, lastColSelected - 1));
+            selectionCoalescer->selectCol(jmax(0, currentCol - 1), false);
     } else if (key.isKeyCode(KeyPress::downKey)) {
         if (multiple)
             selectRangeOfCols(lastColSelected, lastColSelected + 1);
         else
-            selectColumn(jmin(totalItems - 1, jmax(0, lastColSelected) + 1));
+            selectionCoalescer->selectCol(jmin(totalItems - 1, jmax(0, currentCol) + 1), false);
     } else if (key.isKeyCode(KeyPress::pageUpKey)) {
         if (multiple)
             selectRangeOfCols(lastColSelected, lastColSelected - numVisibleColumns);
         else
-            selectColumn(jmax(0, jmax(0, lastColSelected) - numVisibleColumns));
+            selectionCoalescer->selectCol(jmax(0, jmax(0, currentCol) - numVisibleColumns), false);
     } else if (key.isKeyCode(KeyPress::pageDownKey)) {
         if (multiple)
             selectRangeOfCols(lastColSelected, lastColSelected + numVisibleColumns);
         else
-            selectColumn(jmin(totalItems - 1, jmax(0, lastColSelected) + numVisibleColumns));
+            selectionCoalescer->selectCol(jmin(totalItems - 1, jmax(0, currentCol) + numVisibleColumns), false);
     } else if (key.isKeyCode(KeyPress::homeKey)) {
         if (multiple)
             selectRangeOfCols(lastColSelected, 0);
         else
-            selectColumn(0);
+            selectionCoalescer->selectCol(0, false);
     } else if (key.isKeyCode(KeyPress::endKey)) {
         if (multiple)
             selectRangeOfCols(lastColSelected, totalItems - 1);
         else
-            selectColumn(totalItems - 1);
+            selectionCoalescer->selectCol(totalItems - 1, false);
     } else if (key.isKeyCode(KeyPress::returnKey) && isColSelected(lastColSelected)) {
         if (model != nullptr)
-            model->returnKeyPressed(lastColSelected);
+            timeModelCall(callStats.get(), Callback::returnKeyPressed, lastColSelected,
+                          [this] { model->returnKeyPressed(lastColSelected); });
     } else if ((key.isKeyCode(KeyPress::deleteKey) || key.isKeyCode(KeyPress::backspaceKey))
                && isColSelected(lastColSelected)) {
         if (model != nullptr)
-            model->deleteKeyPressed(lastColSelected);
+            timeModelCall(callStats.get(), Callback::deleteKeyPressed, lastColSelected,
+                          [this] { model->deleteKeyPressed(lastColSelected); });
     } else if (multipleSelection && key == KeyPress('a', ModifierKeys::commandModifier, 0)) {
         selectRangeOfCols(0, std::numeric_limits<int>::max());
+    } else if (key.isKeyCode(KeyPress::F3Key)
+               || key == KeyPress('g', ModifierKeys::commandModifier, 0)
+               || key == KeyPress('g', ModifierKeys::commandModifier | ModifierKeys::shiftModifier, 0)) {
+        if (key.getModifiers().isShiftDown())
+            selectPreviousMatch();
+        else
+            selectNextMatch();
+    } else if (typeAheadEnabled
+               && key.getTextCharacter() >= ' '
+               && !(key.getModifiers().isCommandDown() || key.getModifiers().isCtrlDown())) {
+        handleTypeAhead(key.getTextCharacter());
     } else {
         return false;
     }
@@ -673,16 +2223,28 @@ void HorizontalListBox::mouseWheelMove(const MouseEvent &e, const MouseWheelDeta
 
 void HorizontalListBox::mouseUp(const MouseEvent &e) {
     if (e.mouseWasClicked() && model != nullptr)
-        model->backgroundClicked(e);
+        timeModelCall(callStats.get(), Callback::backgroundClicked, -1, [&] { model->backgroundClicked(e); });
 }
 
 //==============================================================================
 void HorizontalListBox::setColWidth(const int newWidth) {
+    if (!viewport->isLayingOutForZoom())
+        viewport->cancelZoom();
+
     colWidth = jmax(1, newWidth);
     viewport->setSingleStepSizes(colWidth, 20);
     updateContent();
 }
 
+void HorizontalListBox::zoomToColWidth(const int newWidth, const int anchorX, const bool animate,
+                                       const int animationMs) {
+    viewport->zoomTo(jmax(1, newWidth), anchorX - viewport->getX(), animate ? animationMs : 0);
+}
+
+int HorizontalListBox::getTargetColWidth() const noexcept {
+    return viewport->getTargetColWidth();
+}
+
 int HorizontalListBox::getNumColsOnScreen() const noexcept {
     return viewport->getMaximumVisibleWidth() / colWidth;
 }
@@ -721,11 +2283,107 @@ void HorizontalListBox::setHeaderComponent(Component *newHeaderComponent) {
     }
 }
 
+void HorizontalListBox::notifyModelOfSelectionChange(const int lastRowSelected) {
+    const ModelCallStats::ScopedCall timing(callStats.get(), Callback::selectedRowsChanged, lastRowSelected, tracer);
+    model->selectedRowsChanged(lastRowSelected);
+}
+
+void HorizontalListBox::setModelCallTimingEnabled(const bool shouldBeEnabled) {
+    if (!shouldBeEnabled) {
+        callStats.reset();
+        return;
+    }
+
+    if (callStats == nullptr) {
+        callStats.reset(new ModelCallStats());
+        callStats->setSlowCallThreshold(slowModelCallFraction * 1000.0 / 60.0);
+
+        callStats->onSlowCall = [this](const Callback callback, const int item, const double milliseconds) {
+            listeners.call([&](Listener &l) { l.listModelCallWasSlow(*this, callback, item, milliseconds); });
+        };
+    }
+}
+
+void HorizontalListBox::setSlowModelCallThreshold(const double fractionOfFrame) {
+    slowModelCallFraction = fractionOfFrame;
+
+    if (callStats != nullptr)
+        callStats->setSlowCallThreshold(slowModelCallFraction * 1000.0 / 60.0);
+}
+
+void HorizontalListBox::setRenderCache(ItemRenderCache *const newCache) {
+    if (renderCache != newCache) {
+        renderCache = newCache;
+        repaint();
+    }
+}
+
+void HorizontalListBox::setCarouselMode(const bool shouldBeCarousel, const float minimumScale,
+                                        const float minimumAlpha) {
+    carouselMinScale = jlimit(0.05f, 1.0f, minimumScale);
+    carouselMinAlpha = jlimit(0.0f, 1.0f, minimumAlpha);
+
+    if (carouselMode != shouldBeCarousel) {
+        carouselMode = shouldBeCarousel;
+
+        if (carouselMode)
+            carouselCache.reset(new ItemRenderCache());
+        else
+            carouselCache.reset();
+
+        repaint();
+    }
+
+    viewport->updateCarouselTransforms();
+
+    if (carouselMode)
+        viewport->focusCol(viewport->getFocusedCol(), false);
+}
+
+int HorizontalListBox::getFocusedCol() const noexcept {
+    return totalItems > 0 ? viewport->getFocusedCol() : -1;
+}
+
+void HorizontalListBox::focusCol(const int col, const bool animate) {
+    if (isPositiveAndBelow(col, totalItems))
+        viewport->focusCol(col, animate);
+}
+
+ItemRenderCache *HorizontalListBox::getCacheForPainting() const noexcept {
+    return renderCache != nullptr ? renderCache : carouselCache.get();
+}
+
+bool HorizontalListBox::isAnimatingZoom() const noexcept {
+    return viewport->isAnimatingZoom();
+}
+
+// Called when the items at some indices have changed or moved. Items with IDs are followed
+// wherever they go, but for items that are only known by index, the columns at those
+// indices have to be repainted even though their indices haven't changed, and the images
+// cached for the indices thrown away.
+void HorizontalListBox::indexedItemsChanged(const Range<int> cols) {
+    if (hasItemIds() || cols.isEmpty())
+        return;
+
+    if (auto *cache = getCacheForPainting())
+        cache->invalidateRange(model, {(int64) cols.getStart(), (int64) cols.getEnd()});
+
+    viewport->itemsChangedIn(cols);
+}
+
+void HorizontalListBox::scrollSettled() {
+    viewport->scrollSettled();
+}
+
 void HorizontalListBox::repaintCol(const int colNumber) noexcept {
-    repaint(getColPosition(colNumber, true));
+    if (auto *cache = getCacheForPainting())
+        cache->invalidate(model, getCacheKeyForCol(colNumber));
+
+    repaint(getColPosition(colNumber, true).expanded(1, 0));
 }
 
 Image HorizontalListBox::createSnapshotOfCols(const SparseSet<int> &cols, int &imageX, int &imageY) {
+    HORIZONTAL_LIST_TRACE_SCOPE(tracer, "createSnapshotOfCols", -1);
     Rectangle<int> imageArea;
     auto firstCol = getColContainingPosition(viewport->getX(), 0);
 
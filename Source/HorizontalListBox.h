@@ -11,6 +11,14 @@
 #pragma once
 
 #include "JuceHeader.h"
+#include "IntervalSet.h"
+#include "HorizontalListBoxModel.h"
+#include "ListTracer.h"
+#include "ModelCallStats.h"
+#include "ItemRenderCache.h"
+#include "ListWorkerPool.h"
+
+class ColumnTextSearch;
 
 
 class HorizontalListBox : public Component,
@@ -37,10 +45,182 @@ public:
     Call this when the number of columns in the list changes, or if you want it
     to call refreshComponentForColumn() on all the column components.
 
+    The items the list already had are assumed to be the same as before, apart from
+    any that have been added to or removed from the end, so appending items to a long
+    list doesn't repaint or throw away the cached images of the ones that are there.
+    If existing items have changed, call colChanged() for them, and if they've been
+    reordered, call allColsChanged() instead of this.
+
     This must only be called from the main message thread.
 */
     void updateContent();
 
+/** Tells the list that any of its items may have changed, e.g. because the model's
+    data has been replaced or sorted, and updates it.
+
+    If the model has item IDs, they're all compared with the ones from before, so the
+    selection, custom components and cached images follow the items that are still
+    there, wherever they've moved to, and only the columns showing different items are
+    repainted. An item with the same ID is assumed to look the same as it did, so call
+    colChanged() or colsChanged() for any that don't. Without IDs, this throws away the
+    cached images of all the model's items and repaints every column. Either way, any
+    search is brought up to date, by searching just the columns whose items have changed
+    or by starting it again, so there's no need to call refreshSearch() as well.
+*/
+    void allColsChanged();
+
+/** Tells the list that some columns have been removed from the start of its model,
+    e.g. because a ring buffer has dropped its oldest items.
+
+    The selection, search matches and scroll position are moved down to match, so
+    the same items stay selected and in view (unless the list is following its tail).
+    Call this after changing the model, and before calling updateContent().
+*/
+    void colsRemovedFromStart(int numRemoved);
+
+/** Tells the list that some columns have been inserted into its model, and updates it.
+
+    The selection and search matches after the insertion point are moved up to match,
+    and if the new columns are before the ones in view, the list scrolls so that the
+    same items stay in view. Call this after changing the model, instead of
+    updateContent().
+*/
+    void colsInserted(int startIndex, int numInserted);
+
+/** Tells the list that some columns have been removed from its model, and updates it.
+
+    This works like colsInserted(), but the other way round. If any of the removed
+    columns were selected, the model is told that the selection has changed.
+*/
+    void colsRemoved(int startIndex, int numRemoved);
+
+/** Tells the list that a column has been moved to a different index in its model, and
+    updates it. The column stays selected if it was.
+*/
+    void colMoved(int oldIndex, int newIndex);
+
+/** Tells the list that one column's item has changed, without any being added or removed.
+
+    If the column is on screen, its component is refreshed and it's repainted, and
+    nothing else in the list is touched.
+*/
+    void colChanged(int col);
+
+/** Tells the list that the items of some columns have changed, like colChanged(), but
+    for any number of them at once.
+*/
+    void colsChanged(const IntervalSet &cols);
+
+/** Makes the list keep its last column in view while items are being added.
+
+    When this is on, updateContent() scrolls to the end of the list. If the user
+    scrolls away from the end, the list stops following until they scroll back
+    there. This is off by default.
+
+    @see isFollowingTail
+*/
+    void setFollowsTail(bool shouldFollowTail);
+
+/** Returns true if the list is currently keeping its last column in view.
+    @see setFollowsTail
+*/
+    bool isFollowingTail() const noexcept { return followingTail; }
+
+//==============================================================================
+/** Receives callbacks when the list's content is changed. */
+    class Listener {
+    public:
+        virtual ~Listener() = default;
+
+    /** Called at the end of updateContent(), with the number of columns the list now has.
+        The methods that say which columns have changed, like colsInserted(), call their
+        own callback instead of this one.
+    */
+        virtual void listContentUpdated(HorizontalListBox &list, int numCols) { ignoreUnused(list, numCols); }
+
+    /** Called at the end of allColsChanged(), with the number of columns the list now has. */
+        virtual void listAllColsChanged(HorizontalListBox &list, int numCols) { ignoreUnused(list, numCols); }
+
+    /** Called at the end of colsRemovedFromStart(). */
+        virtual void listColsRemovedFromStart(HorizontalListBox &list, int numRemoved) {
+            ignoreUnused(list, numRemoved);
+        }
+
+    /** Called at the end of colsInserted(), with the index the columns were inserted at. */
+        virtual void listColsInserted(HorizontalListBox &list, int startIndex, int numInserted) {
+            ignoreUnused(list, startIndex, numInserted);
+        }
+
+    /** Called at the end of colsRemoved(), with the columns that were actually removed. */
+        virtual void listColsRemoved(HorizontalListBox &list, int startIndex, int numRemoved) {
+            ignoreUnused(list, startIndex, numRemoved);
+        }
+
+    /** Called at the end of colMoved(). */
+        virtual void listColMoved(HorizontalListBox &list, int oldIndex, int newIndex) {
+            ignoreUnused(list, oldIndex, newIndex);
+        }
+
+    /** Called at the end of colChanged(). */
+        virtual void listColChanged(HorizontalListBox &list, int col) { ignoreUnused(list, col); }
+
+    /** Called at the end of colsChanged(). */
+        virtual void listColsChanged(HorizontalListBox &list, const IntervalSet &cols) { ignoreUnused(list, cols); }
+
+    /** Called when a call into the model took longer than the threshold set with
+        setSlowModelCallThreshold(). This is only checked while model call timing is on.
+        The item is the column the call was for, or -1.
+    */
+        virtual void listModelCallWasSlow(HorizontalListBox &list, ModelCallStats::Callback callback,
+                                          int item, double milliseconds) {
+            ignoreUnused(list, callback, item, milliseconds);
+        }
+
+    /** Called whenever the list's scroll position changes, including by part of a pixel.
+        @see getScrollPositionX
+    */
+        virtual void listWasScrolled(HorizontalListBox &list) { ignoreUnused(list); }
+    };
+
+/** Registers a listener to be told when the content changes. */
+    void addListener(Listener *listener) { listeners.add(listener); }
+
+/** Removes a listener that was added with addListener(). */
+    void removeListener(Listener *listener) { listeners.remove(listener); }
+
+/** Makes the list add trace events for its updates, painting, selection changes and
+    model callbacks to a tracer, or stops it if this is null (the default). The tracer
+    isn't owned, and it can be shared between lists.
+*/
+    void setTracer(ListTracer *newTracer) noexcept { tracer = newTracer; }
+
+/** Returns the tracer set with setTracer(), so that a model can add its own events. */
+    ListTracer *getTracer() const noexcept { return tracer; }
+
+/** Makes the list keep the images of the items it paints in a cache, or stops it if
+    this is null (the default). The cache isn't owned, and lists that show the same
+    model can share one.
+    @see ItemRenderCache
+*/
+    void setRenderCache(ItemRenderCache *newCache);
+
+/** Returns the cache set with setRenderCache(). */
+    ItemRenderCache *getRenderCache() const noexcept { return renderCache; }
+
+/** Turns on timing of every call the list makes into its model, which is off by
+    default. The times are kept in a histogram for each callback.
+    @see getModelCallStats, setSlowModelCallThreshold
+*/
+    void setModelCallTimingEnabled(bool shouldBeEnabled);
+
+/** Returns the model call timings, or nullptr if timing isn't turned on. */
+    ModelCallStats *getModelCallStats() const noexcept { return callStats.get(); }
+
+/** Sets how much of a 60Hz frame a single call into the model can take before the
+    listeners' listModelCallWasSlow() is called. The default is 0.5.
+*/
+    void setSlowModelCallThreshold(double fractionOfFrame);
+
 //==============================================================================
 /** Turns on multiple-selection of columns.
 
@@ -124,10 +304,22 @@ public:
     void flipColSelection(int columnNumber);
 
 /** Returns a sparse set indicating the columns that are currently selected.
-    @see setSelectedColumns
+
+    This has to convert the whole selection, so for large selections prefer
+    getSelection(), which doesn't copy anything.
+
+    @see setSelectedColumns, getSelection
 */
     SparseSet<int> getSelectedCols() const;
 
+/** Returns the set of currently selected columns, without copying it.
+
+    The reference is only valid until the selection next changes.
+
+    @see getSelectedCols
+*/
+    const IntervalSet &getSelection() const noexcept { return selected; }
+
 /** Sets the columns that should be selected, based on an explicit set of ranges.
 
     If sendNotificationEventToModel is true, the HorizontalListBoxModel::selectedColumnsChanged()
@@ -138,6 +330,12 @@ public:
     void setSelectedCols(const SparseSet<int> &setOfColumnsToBeSelected,
                          const NotificationType sendNotificationEventToModel = sendNotification);
 
+/** Sets the columns that should be selected, based on an IntervalSet.
+    @see getSelection
+*/
+    void setSelectedCols(const IntervalSet &setOfColumnsToBeSelected,
+                         const NotificationType sendNotificationEventToModel = sendNotification);
+
 /** Checks whether a column is selected.
 */
     bool isColSelected(int columnNumber) const;
@@ -185,6 +383,87 @@ public:
                                        ModifierKeys modifiers,
                                        bool isMouseUpEvent);
 
+/** Selects every column for which a predicate returns true.
+
+    The predicate is evaluated over all the columns in parallel chunks on the shared
+    ListWorkerPool, so it'll be called from several threads at once and must be safe
+    to use that way - it mustn't touch components or anything else that belongs to
+    the message thread.
+
+    The new selection is applied in one go, with a single call to the model's
+    selectedRowsChanged() if sendNotificationEventToModel is sendNotification.
+
+    If multiple selection isn't enabled, only the first matching column is selected.
+
+    @param predicate                  called with each column number
+    @param addToCurrentSelection      if true, the matching columns are added to the current
+                                      selection, otherwise they replace it
+    @see invertSelection, setSelectedCols
+*/
+    void selectWhere(const std::function<bool(int)> &predicate,
+                     bool addToCurrentSelection = false,
+                     NotificationType sendNotificationEventToModel = sendNotification);
+
+/** Selects all the columns that aren't selected, and deselects all the ones that are.
+
+    This only has an effect if multiple selection is enabled.
+    @see selectWhere
+*/
+    void invertSelection(NotificationType sendNotificationEventToModel = sendNotification);
+
+//==============================================================================
+/** Starts searching the columns' text for a string.
+
+    This only works if the model is a HorizontalListBoxModel, because the text comes from
+    its getTextForCol() method, which will be called on the ListWorkerPool's threads.
+
+    The search runs in the background, and matches are highlighted with the
+    searchHighlightColourId colour as they're found. If the new text contains the
+    previous search text, only the columns that matched before are checked again.
+
+    Columns appended by updateContent() are searched too, but if the text of existing
+    columns changes you'll need to call this again.
+
+    @see selectNextMatch, selectPreviousMatch, clearSearch, getSearchMatches
+*/
+    void findText(const String &textToFind, bool ignoreCase = true);
+
+/** Cancels any search and removes its highlights. */
+    void clearSearch();
+
+/** Runs the current search again over all the columns.
+
+    Call this if the text of existing columns has changed, or if they've been
+    reordered, so that the matches are found again.
+*/
+    void refreshSearch();
+
+/** Returns the columns that the current search has matched so far. */
+    const IntervalSet &getSearchMatches() const noexcept;
+
+/** Returns true while a search is still checking columns. */
+    bool isSearching() const noexcept;
+
+/** Selects the first search match after the last selected column, wrapping around
+    at the end, and scrolls to make sure it's on-screen.
+    Returns false if there aren't any matches.
+*/
+    bool selectNextMatch();
+
+/** Selects the last search match before the last selected column, wrapping around
+    at the start, and scrolls to make sure it's on-screen.
+    Returns false if there aren't any matches.
+*/
+    bool selectPreviousMatch();
+
+/** Enables type-ahead, where typing while the list has focus searches for the typed
+    text and jumps to the first match at or after the selected column.
+
+    The typed text is reset after a second without any key presses.
+    This is disabled by default.
+*/
+    void setTypeAheadEnabled(bool shouldBeEnabled) noexcept;
+
 //==============================================================================
 /** Scrolls the list to a particular position.
 
@@ -207,6 +486,24 @@ public:
 */
     double getHorizontalPosition() const;
 
+/** Scrolls the list so that the given number of pixels are off-screen to the left.
+
+    The position doesn't have to be a whole number of pixels: the part that's left
+    over is applied as a transform to all the columns at once, so slow animated
+    scrolls move smoothly rather than in one-pixel steps.
+
+    If animate is true, the list glides to the new position over the given number of
+    milliseconds. Any other scrolling stops the animation.
+
+    @see getScrollPositionX
+*/
+    void setScrollPositionX(double newX, bool animate = false, int animationMs = 250);
+
+/** Returns the exact scroll position, in pixels.
+    @see setScrollPositionX
+*/
+    double getScrollPositionX() const noexcept;
+
 /** Scrolls if necessary to make sure that a particular column is visible. */
     void scrollToEnsureColIsOnscreen(int col);
 
@@ -280,6 +577,26 @@ public:
 */
     int getColWidth() const noexcept { return colWidth; }
 
+/** Changes the column width while keeping the point at anchorX (relative to this
+    component) where it is, the way a timeline zooms around the mouse pointer.
+
+    An animated zoom is drawn by scaling the columns that are already there, so the
+    list is only laid out again once, rather than on every step.
+    @see setWheelZoomRange, getTargetColWidth
+*/
+    void zoomToColWidth(int newWidth, int anchorX, bool animate = false, int animationMs = 200);
+
+/** Returns the width that the columns are zooming to, or their current width if
+    they're not being zoomed.
+*/
+    int getTargetColWidth() const noexcept;
+
+/** Lets the mouse wheel zoom the list around the pointer while the command key (ctrl
+    on Windows and Linux) is held down, keeping the column width within this range.
+    An empty range, which is the default, turns this off.
+*/
+    void setWheelZoomRange(Range<int> allowedColWidths) noexcept { wheelZoomRange = allowedColWidths; }
+
 /** Returns the number of columns actually visible.
 
     This is the number of whole columns which will fit on-screen, so the value might
@@ -300,7 +617,9 @@ public:
                                                   Make this transparent if you don't want the background to be filled. */
         outlineColourId = 0x1002810, /**< An optional colour to use to draw a border around the list.
                                                   Make this transparent to not have an outline. */
-        textColourId = 0x1002820  /**< The preferred colour to use for drawing text in the HorizontalListBox. */
+        textColourId = 0x1002820, /**< The preferred colour to use for drawing text in the HorizontalListBox. */
+        searchHighlightColourId = 0x1002830  /**< The colour drawn over columns that match the current search.
+                                                  This should be semi-transparent, as it's drawn on top of the items. */
     };
 
 /** Sets the thickness of a border that will be drawn around the box.
@@ -349,10 +668,72 @@ public:
 /** Repaints one of the columns.
 
     This does not invoke updateContent(), it just invokes a straightforward repaint
-    for the area covered by this column.
+    for the area covered by this column. Any image of it in the list's render cache
+    is thrown away.
 */
     void repaintCol(int colNumber) noexcept;
 
+//==============================================================================
+/** Sets when the list should ask its model to paint items at reduced detail.
+
+    Items are painted at reduced detail while the list is scrolling faster than
+    colsPerSecond, or while painting the columns that scroll into view would take up
+    more than paintBudgetMs of each frame. When scrolling slows down or stops, the
+    visible columns are repainted in full detail.
+
+    The defaults are 40 columns per second and 8ms. Pass 0 for colsPerSecond to
+    always paint in full detail.
+
+    @see HorizontalListBoxModel::paintListBoxItemWithDetail, isScrollingFast
+*/
+    void setReducedDetailThresholds(float colsPerSecond, double paintBudgetMs);
+
+/** Returns true while the list is scrolling too fast for its items to be painted
+    in full detail.
+*/
+    bool isScrollingFast() const noexcept;
+
+/** Sets how long the list can spend calling the model's refreshComponentForRow() in
+    each frame.
+
+    When a jump replaces all the visible columns at once, the ones nearest the middle
+    are refreshed first, and any that don't fit in the budget are painted at reduced
+    detail, with their components hidden, until they're refreshed on a later frame.
+    At least one column is always refreshed per frame.
+
+    The default is 6ms. Pass 0 to always refresh all the columns straight away.
+*/
+    void setComponentRefreshBudget(double millisecondsPerFrame) noexcept;
+
+//==============================================================================
+/** Turns carousel mode on or off. It's off by default.
+
+    In carousel mode, the focused column is shown full size, and the columns either
+    side of it shrink towards minimumScale and fade towards minimumAlpha as they get
+    further from it. The focus point is the middle of the list, except near its ends,
+    where it moves out so that the first and last columns can be focused too. When
+    the list stops scrolling, it glides to put the nearest column in focus.
+
+    The columns are scaled and faded with transforms. They're painted once at full
+    size into the render cache (the list makes its own if it hasn't been given one),
+    so scrolling doesn't make the model paint them again at every size. A column's
+    custom component, if it has one, is scaled and faded along with it.
+
+    @see getFocusedCol, focusCol, setRenderCache
+*/
+    void setCarouselMode(bool shouldBeCarousel, float minimumScale = 0.7f, float minimumAlpha = 0.5f);
+
+/** Returns true if carousel mode is on. */
+    bool isCarouselMode() const noexcept { return carouselMode; }
+
+/** Returns the column nearest the focus point, or -1 if the list is empty. This works
+    whether or not carousel mode is on.
+*/
+    int getFocusedCol() const noexcept;
+
+/** Scrolls the list to put a column in focus. */
+    void focusCol(int col, bool animate = true);
+
 /** This fairly obscure method creates an image that shows the column components specified
     in columns (for example, these could be the currently selected column components).
 
@@ -415,23 +796,97 @@ private:
 
     JUCE_PUBLIC_IN_DLL_BUILD (class ColumnComponent)
 
+    JUCE_PUBLIC_IN_DLL_BUILD (class ScrollSpeedTracker)
+
+    JUCE_PUBLIC_IN_DLL_BUILD (class SelectionCoalescer)
+
+    JUCE_PUBLIC_IN_DLL_BUILD (class RefreshScheduler)
+
     friend class ListViewport;
 
     friend class TableHorizontalListBox;
 
+    friend struct ListBoxMouseMoveSelector;
+
+    friend class ListTraceReplayer;
+
     ListBoxModel *model;
+    HorizontalListBoxModel *extendedModel;
     std::unique_ptr<ListViewport> viewport;
     std::unique_ptr<Component> headerComponent;
     std::unique_ptr<MouseListener> mouseMoveSelector;
-    SparseSet<int> selected;
+    std::unique_ptr<ColumnTextSearch> textSearch;
+    std::unique_ptr<ScrollSpeedTracker> scrollSpeedTracker;
+    std::unique_ptr<SelectionCoalescer> selectionCoalescer;
+    IntervalSet selected;
+    ListenerList<Listener> listeners;
+    ListTracer *tracer = nullptr;
+    ItemRenderCache *renderCache = nullptr;
+    std::unique_ptr<ItemRenderCache> carouselCache;
+    std::unique_ptr<ModelCallStats> callStats;
+    SharedResourcePointer<ListWorkerPool> workerPool;
+    double slowModelCallFraction = 0.5, refreshBudgetMs = 6.0;
+    String typeAheadText;
     int totalItems = 0, colWidth = 22, minimumColWidth = 0;
+    Range<int> wheelZoomRange;
     int outlineThickness = 0;
-    int lastColSelected = -1;
+    int lastColSelected = -1, typeAheadStartCol = 0;
+    uint32 lastTypeAheadTime = 0;
     bool multipleSelection = false, alwaysFlipSelection = false, hasDoneInitialUpdate = false, selectOnMouseDown = true;
+    bool typeAheadEnabled = false, typeAheadJumpPending = false;
+    bool followsTail = false, followingTail = false, isScrollingToTail = false;
+    bool carouselMode = false, itemIdsValid = false, itemsReordered = false, comparingItemIds = false;
+    std::vector<int64> itemIds; // from the last update, if the model has them
+    float carouselMinScale = 0.7f, carouselMinAlpha = 0.5f;
 
     void selectColInternal(int col, bool dontScrollToShowThisColumn,
                            bool deselectOthersFirst, bool isMouseClick);
 
+    void selectionReplaced(NotificationType sendNotificationEventToModel);
+
+    void notifyModelOfSelectionChange(int lastRowSelected);
+
+    bool selectMatchNear(int col, bool forwards);
+
+    void keepColsInViewAfterShift(int firstChangedCol, int numColsShifted);
+
+    int64 getItemIdForCol(int col) const noexcept;
+
+    int64 getCacheKeyForCol(int col) const noexcept;
+
+    bool hasItemIds() const noexcept;
+
+    void updateContentWithoutNotifying();
+
+    void updateItemIds();
+
+    bool followItemIds(bool &selectionChanged);
+
+    void insertItemIds(Range<int> cols);
+
+    void removeItemIds(Range<int> cols);
+
+    void handleTypeAhead(juce_wchar character);
+
+    void repaintColsIn(const IntervalSet &cols);
+
+    template <typename Callback>
+    void forEachDrawnColArea(const IntervalSet &cols, Callback &&callback) const;
+
+    void repaintColsWithReducedDetail();
+
+    ItemRenderCache *getCacheForPainting() const noexcept;
+
+    bool isAnimatingZoom() const noexcept;
+
+    void indexedItemsChanged(Range<int> cols);
+
+    void scrollSettled();
+
+    void scrollToTail();
+
+    void updateTailFollowing();
+
 #if JUCE_CATCH_DEPRECATED_CODE_MISUSE
 // This method's bool parameter has changed: see the new method signature.
     JUCE_DEPRECATED (void setSelectedColumns(const SparseSet<int> &, bool));
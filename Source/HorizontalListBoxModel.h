@@ -0,0 +1,139 @@
+/*
+  ==============================================================================
+
+    HorizontalListBoxModel.h
+    Created: 18 Oct 2026 7:01:47pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "TextLayoutCache.h"
+#include "IntervalSet.h"
+
+/**
+    A ListBoxModel with some extra callbacks that HorizontalListBox knows how to use.
+
+    HorizontalListBox works with any ListBoxModel, but when its model is one of these,
+    it'll also use the extra methods here. All of them have default implementations,
+    so you only need to override the ones for the features you want.
+*/
+class HorizontalListBoxModel : public ListBoxModel {
+public:
+    //==============================================================================
+    /** How much detail the list wants an item painted with. */
+    enum class DetailLevel {
+        full,   /**< The item should be painted normally. */
+        reduced /**< The list is scrolling too fast for anyone to read the item, so a cheap
+                     representation of it will do. It'll be repainted in full detail when
+                     the list stops. */
+    };
+
+    /** Paints an item at a given level of detail.
+
+        HorizontalListBox calls this rather than paintListBoxItem(), so override it if
+        your items have a cheaper way of painting themselves while the list is scrolling
+        quickly. The default just calls paintListBoxItem().
+    */
+    virtual void paintListBoxItemWithDetail(int rowNumber, Graphics &g, int width, int height,
+                                            bool rowIsSelected, DetailLevel detail) {
+        ignoreUnused(detail);
+        paintListBoxItem(rowNumber, g, width, height, rowIsSelected);
+    }
+
+    //==============================================================================
+    /** Returns the plain text of a column, which is what HorizontalListBox::findText()
+        and type-ahead match against.
+
+        This is called on the ListWorkerPool's threads while a search is running, so
+        it must be safe to call from any thread. The default returns an empty string,
+        which means nothing is ever found.
+    */
+    virtual String getTextForCol(int colNumber) {
+        ignoreUnused(colNumber);
+        return {};
+    }
+
+    /** Called on the message thread when the range of columns on screen changes, or
+        the columns change size.
+
+        colsToPrefetch are the columns just off screen in the direction the list is
+        scrolling, so a model that needs to do some slow work before it can paint a
+        column (laying out text, loading images, etc.) can start it early, e.g. with
+        prepareCachedTextAsync().
+    */
+    virtual void visibleColsChanged(Range<int> visibleCols, Range<int> colsToPrefetch,
+                                    int colWidth, int colHeight) {
+        ignoreUnused(visibleCols, colsToPrefetch, colWidth, colHeight);
+    }
+
+    /** Called instead of visibleColsChanged() when this model's items are being shown by
+        another model that filters or reorders them, such as a ListBoxModelView, so the
+        items on screen needn't be next to each other.
+
+        The items are this model's indices, and centreItem is the one nearest the middle
+        of the screen, or -1 if there isn't one. The default calls visibleColsChanged()
+        for each contiguous run of items, so a model that only keeps work going for the
+        columns it was last told about should override this.
+    */
+    virtual void visibleItemsChanged(const IntervalSet &visibleItems, const IntervalSet &itemsToPrefetch,
+                                     int centreItem, int colWidth, int colHeight) {
+        ignoreUnused(centreItem);
+
+        for (auto &r : visibleItems)
+            visibleColsChanged(r, {}, colWidth, colHeight);
+
+        for (auto &r : itemsToPrefetch)
+            visibleColsChanged({}, r, colWidth, colHeight);
+    }
+
+    /** Returns a number that identifies the item in a column, and stays with it wherever
+        it moves, e.g. a database key. IDs must be unique and not negative.
+
+        If this returns IDs, the selection, the columns' custom components and any cached
+        images of the items follow them when they're inserted, removed or moved with
+        HorizontalListBox::colsInserted() and its siblings. When allColsChanged() is
+        called, the list compares all of the IDs with the ones it had before, so the
+        selection and custom components follow items that have been reordered in any way.
+        The list assumes that an item with the same ID looks the same as it did, so call
+        HorizontalListBox::colChanged() for items that have changed.
+
+        updateContent() only asks for the IDs of columns that have been added to the end,
+        but allColsChanged() asks for every column's, so this needs to be quick. The
+        default returns -1, which means the items don't have IDs and are only known by
+        their index.
+    */
+    virtual int64 getItemId(int colNumber) {
+        ignoreUnused(colNumber);
+        return -1;
+    }
+
+protected:
+    //==============================================================================
+    /** Draws a line of text like Graphics::drawText(), but keeps the layout in a
+        TextLayoutCache that's shared by all models, so that repainting a column
+        doesn't have to lay its text out again.
+    */
+    void drawCachedText(Graphics &g, const String &text, const Font &font, Rectangle<int> area,
+                        Justification justification, bool useEllipsesIfTooBig = true) {
+        textLayoutCache->drawText(g, text, font, area, justification, useEllipsesIfTooBig);
+    }
+
+    /** Lays out some lines of text on a background thread, so that drawCachedText()
+        calls with the same font, area size and justification will find them ready.
+    */
+    void prepareCachedTextAsync(const StringArray &texts, const Font &font, Rectangle<int> area,
+                                Justification justification, bool useEllipsesIfTooBig = true) {
+        textLayoutCache->prepareAsync(texts, font, area.getWidth(), area.getHeight(),
+                                      justification, useEllipsesIfTooBig);
+    }
+
+    /** Returns the shared cache that drawCachedText() uses. */
+    TextLayoutCache &getTextLayoutCache() noexcept { return *textLayoutCache; }
+
+private:
+    SharedResourcePointer<TextLayoutCache> textLayoutCache;
+};
@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    ImageStripModel.cpp
+    Created: 18 Oct 2026 7:08:08pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ImageStripModel.h"
+
+//==============================================================================
+ImageStripModel::ImageStripModel() : FileStripModel(64 * 1024 * 1024) {}
+
+ImageStripModel::~ImageStripModel() {
+    stopLoading();
+}
+
+void ImageStripModel::setThumbnailMargin(const int newMargin) {
+    margin = jmax(0, newMargin);
+
+    if (listBox != nullptr)
+        listBox->repaint();
+}
+
+//==============================================================================
+void ImageStripModel::paintListBoxItemWithDetail(const int rowNumber, Graphics &g, const int width,
+                                                 const int height, const bool rowIsSelected,
+                                                 const DetailLevel detail) {
+    auto &lf = LookAndFeel::getDefaultLookAndFeel();
+    const auto file = getFile(rowNumber);
+    const auto area = Rectangle<int>(width, height).reduced(margin);
+    const auto thumbnail = findItem(rowNumber, file);
+
+    if (thumbnail != nullptr && thumbnail->image.isValid()) {
+        // an old thumbnail of the wrong size will be replaced soon, so draw it cheaply
+        if (thumbnail->targetSize != getTarget() || detail == DetailLevel::reduced)
+            g.setImageResamplingQuality(Graphics::lowResamplingQuality);
+
+        g.drawImageWithin(thumbnail->image, area.getX(), area.getY(), area.getWidth(), area.getHeight(),
+                          RectanglePlacement::centred);
+    } else {
+        g.setColour(lf.findColour(ListBox::backgroundColourId).contrasting(0.1f));
+        g.fillRect(area);
+
+        if (detail == DetailLevel::full) {
+            g.setColour(lf.findColour(ListBox::textColourId).withMultipliedAlpha(0.6f));
+            drawCachedText(g, file.getFileName(), Font(jlimit(10.0f, 14.0f, height * 0.1f)),
+                           area.reduced(4), Justification::centred);
+        }
+    }
+
+    if (rowIsSelected) {
+        g.setColour(lf.findColour(TextEditor::highlightColourId));
+        g.drawRect(0, 0, width, height, jmax(2, margin / 2));
+    }
+}
+
+//==============================================================================
+Rectangle<int> ImageStripModel::getTargetFor(const int colWidth, const int colHeight) const {
+    // thumbnails are made at the display's pixel density, so that they're drawn 1:1
+    const auto scale = Desktop::getInstance().getDisplays().getMainDisplay().scale;
+
+    return {roundToInt(jmax(1, colWidth - margin * 2) * scale),
+            roundToInt(jmax(1, colHeight - margin * 2) * scale)};
+}
+
+bool ImageStripModel::isGoodEnoughFor(const ImageStripThumbnail &thumbnail, const Rectangle<int> &targetSize) const {
+    return thumbnail.targetSize == targetSize;
+}
+
+ImageStripModel::ItemPtr ImageStripModel::loadItem(const File &file, const Rectangle<int> &targetSize) {
+    auto thumbnail = std::make_shared<ImageStripThumbnail>();
+    thumbnail->image = createThumbnail(file, targetSize);
+    thumbnail->targetSize = targetSize;
+
+    // a file that can't be decoded still gets an entry, so it isn't retried on every paint
+    return thumbnail;
+}
+
+Image ImageStripModel::createThumbnail(const File &file, const Rectangle<int> maxSize) {
+    auto image = ImageFileFormat::loadFrom(file);
+
+    if (!image.isValid())
+        return {};
+
+    const auto scale = jmin(1.0,
+                            maxSize.getWidth() / (double) image.getWidth(),
+                            maxSize.getHeight() / (double) image.getHeight());
+
+    const auto w = jmax(1, roundToInt(image.getWidth() * scale));
+    const auto h = jmax(1, roundToInt(image.getHeight() * scale));
+
+    // halve the size until it's close, because the resampler only looks at the
+    // nearest few source pixels and would alias badly on a big reduction
+    while (image.getWidth() > w * 2 && image.getHeight() > h * 2)
+        image = image.rescaled(image.getWidth() / 2, image.getHeight() / 2, Graphics::mediumResamplingQuality);
+
+    if (image.getWidth() != w || image.getHeight() != h)
+        image = image.rescaled(w, h, Graphics::mediumResamplingQuality);
+
+    return image;
+}
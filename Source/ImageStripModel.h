@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    ImageStripModel.h
+    Created: 18 Oct 2026 7:08:08pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "FileStripModel.h"
+
+/** A thumbnail made by an ImageStripModel, and the size it was made to fit. */
+struct ImageStripThumbnail {
+    Image image;
+    Rectangle<int> targetSize;
+
+    int64 getSizeInBytes() const noexcept {
+        return image.isValid() ? (int64) image.getWidth() * image.getHeight() * 4 : 0;
+    }
+};
+
+/**
+    A model that shows a strip of image files as thumbnails.
+
+    Each file is decoded with ImageFileFormat on the ListWorkerPool and scaled down to
+    fit the column, and a column whose thumbnail isn't ready paints a placeholder.
+    Thumbnails are kept in an LRU cache with a limit on the number of bytes it uses,
+    which is 64MB by default. When the columns change size, the cached thumbnails are
+    still drawn (scaled) until replacements of the new size have been made.
+
+    @see FileStripModel
+*/
+class ImageStripModel : public FileStripModel<ImageStripThumbnail, Rectangle<int>> {
+public:
+    ImageStripModel();
+
+    ~ImageStripModel() override;
+
+    /** Sets the gap left around each thumbnail, in pixels. */
+    void setThumbnailMargin(int newMargin);
+
+    //==============================================================================
+    /** @internal */
+    void paintListBoxItemWithDetail(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected,
+                                    DetailLevel detail) override;
+
+private:
+    //==============================================================================
+    int margin = 4;
+
+    Rectangle<int> getTargetFor(int colWidth, int colHeight) const override;
+
+    bool isGoodEnoughFor(const ImageStripThumbnail &thumbnail, const Rectangle<int> &targetSize) const override;
+
+    ItemPtr loadItem(const File &file, const Rectangle<int> &targetSize) override;
+
+    static Image createThumbnail(const File &file, Rectangle<int> maxSize);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ImageStripModel)
+};
@@ -0,0 +1,387 @@
+/*
+  ==============================================================================
+
+    IntervalSet.h
+    Created: 18 Oct 2026 6:57:21pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+    A set of integers, held as a sorted array of disjoint, non-touching ranges.
+
+    This does the same job as SparseSet<int>, but membership tests and indexed
+    lookups are binary searches instead of linear scans, and the number of values
+    in the set is cached. That keeps the list's per-column selection checks cheap
+    even when a selection is made of hundreds of thousands of separate ranges.
+
+    The ranges can be iterated in place (with begin()/end() or getOverlappingRanges())
+    so callers never need to copy the set just to look at it.
+
+    Reading from several threads at once is fine, but any modification must be
+    synchronised by the caller.
+*/
+class IntervalSet {
+public:
+    /** A non-owning view of a contiguous run of the set's ranges.
+        It's only valid until the set is next modified.
+    */
+    struct RangeView {
+        const Range<int> *first = nullptr, *last = nullptr;
+
+        const Range<int> *begin() const noexcept { return first; }
+
+        const Range<int> *end() const noexcept { return last; }
+
+        int size() const noexcept { return (int) (last - first); }
+
+        bool isEmpty() const noexcept { return first == last; }
+    };
+
+    IntervalSet() = default;
+
+    /** Creates a set containing all the values in a range. */
+    explicit IntervalSet(Range<int> range) { addRange(range); }
+
+    /** Creates a set containing the same values as a SparseSet. */
+    explicit IntervalSet(const SparseSet<int> &other) {
+        for (int i = 0; i < other.getNumRanges(); ++i)
+            addRange(other.getRange(i));
+    }
+
+    //==============================================================================
+    /** Removes all values from the set. */
+    void clear() noexcept {
+        ranges.clearQuick();
+        runningTotals.clearQuick();
+    }
+
+    /** Returns true if the set contains no values. */
+    bool isEmpty() const noexcept { return ranges.isEmpty(); }
+
+    /** Returns the number of values in the set. */
+    int size() const noexcept { return runningTotals.isEmpty() ? 0 : runningTotals.getLast(); }
+
+    /** Returns the Nth value in the set, in ascending order.
+        If the index is out of range, this returns 0, like SparseSet does.
+    */
+    int operator[](int index) const noexcept {
+        if (!isPositiveAndBelow(index, size()))
+            return 0;
+
+        auto i = (int) (std::upper_bound(runningTotals.begin(), runningTotals.end(), index) - runningTotals.begin());
+        auto &r = ranges.getReference(i);
+
+        return r.getEnd() - (runningTotals.getUnchecked(i) - index);
+    }
+
+    /** Checks whether a value is in the set. */
+    bool contains(int value) const noexcept {
+        auto i = findFirstRangeEndingAfter(value);
+        return i < ranges.size() && ranges.getReference(i).getStart() <= value;
+    }
+
+    /** Checks whether every value in the given range is in the set. */
+    bool containsRange(Range<int> range) const noexcept {
+        if (range.isEmpty())
+            return false;
+
+        auto i = findFirstRangeEndingAfter(range.getStart());
+        return i < ranges.size() && ranges.getReference(i).contains(range);
+    }
+
+    /** Checks whether any of the values in the given range are in the set. */
+    bool overlapsRange(Range<int> range) const noexcept {
+        if (range.isEmpty())
+            return false;
+
+        auto i = findFirstRangeEndingAfter(range.getStart());
+        return i < ranges.size() && ranges.getReference(i).getStart() < range.getEnd();
+    }
+
+    //==============================================================================
+    /** Adds a range of values to the set, merging it with any ranges it touches. */
+    void addRange(Range<int> range) {
+        if (range.isEmpty())
+            return;
+
+        // ranges that overlap or touch the new one get merged into it
+        auto first = findFirstRangeEndingAtOrAfter(range.getStart());
+        auto last = findFirstRangeStartingAfter(range.getEnd());
+
+        if (first < last) {
+            range = range.getUnionWith(ranges.getReference(first))
+                         .getUnionWith(ranges.getReference(last - 1));
+
+            ranges.removeRange(first + 1, last - first - 1);
+            ranges.set(first, range);
+        } else {
+            ranges.insert(first, range);
+        }
+
+        updateRunningTotalsFrom(first);
+    }
+
+    /** Adds all the values from another set.
+        This merges the two sets' ranges in a single pass.
+    */
+    void addSet(const IntervalSet &other) {
+        if (other.isEmpty())
+            return;
+
+        if (isEmpty()) {
+            *this = other;
+            return;
+        }
+
+        Array<Range<int>> merged;
+        merged.ensureStorageAllocated(ranges.size() + other.ranges.size());
+
+        auto *a = begin();
+        auto *b = other.begin();
+
+        while (a != end() || b != other.end()) {
+            auto &next = (b == other.end() || (a != end() && a->getStart() <= b->getStart())) ? *a++ : *b++;
+
+            if (!merged.isEmpty() && merged.getReference(merged.size() - 1).getEnd() >= next.getStart())
+                merged.getReference(merged.size() - 1) = merged.getReference(merged.size() - 1).getUnionWith(next);
+            else
+                merged.add(next);
+        }
+
+        ranges.swapWith(merged);
+        updateRunningTotalsFrom(0);
+    }
+
+    /** Removes a range of values from the set, splitting any range that straddles it. */
+    void removeRange(Range<int> range) {
+        if (range.isEmpty())
+            return;
+
+        auto first = findFirstRangeEndingAfter(range.getStart());
+        auto last = findFirstRangeStartingAtOrAfter(range.getEnd());
+
+        if (first >= last)
+            return;
+
+        const auto head = ranges.getReference(first);
+        const auto tail = ranges.getReference(last - 1);
+
+        ranges.removeRange(first, last - first);
+        auto insertAt = first;
+
+        if (head.getStart() < range.getStart())
+            ranges.insert(insertAt++, {head.getStart(), range.getStart()});
+
+        if (tail.getEnd() > range.getEnd())
+            ranges.insert(insertAt, {range.getEnd(), tail.getEnd()});
+
+        updateRunningTotalsFrom(first);
+    }
+
+    /** Removes a range of values, and moves all the values above it down to close the gap,
+        in the same way that indices change when items are removed from an array.
+    */
+    void removeAndShift(Range<int> range) {
+        if (range.isEmpty())
+            return;
+
+        removeRange(range);
+
+        auto first = findFirstRangeStartingAtOrAfter(range.getEnd());
+
+        for (auto i = first; i < ranges.size(); ++i)
+            ranges.getReference(i) -= range.getLength();
+
+        // the values either side of the gap may now join up
+        if (first > 0 && first < ranges.size()
+            && ranges.getReference(first - 1).getEnd() == ranges.getReference(first).getStart()) {
+            ranges.getReference(first - 1) = ranges.getReference(first - 1).getUnionWith(ranges.getReference(first));
+            ranges.remove(first);
+            updateRunningTotalsFrom(first - 1);
+        }
+    }
+
+    /** Moves all the values at or above the start of a range up by its length, in the
+        same way that indices change when items are inserted into an array. The values
+        in the gap aren't added to the set.
+    */
+    void insertAndShift(Range<int> range) {
+        if (range.isEmpty())
+            return;
+
+        const auto first = findFirstRangeEndingAfter(range.getStart());
+
+        if (first >= ranges.size())
+            return;
+
+        // a range that straddles the insertion point is split in two around the gap
+        const auto straddling = ranges.getReference(first);
+        auto firstToMove = first;
+
+        if (straddling.getStart() < range.getStart()) {
+            ranges.set(first, {straddling.getStart(), range.getStart()});
+            ranges.insert(++firstToMove, {range.getStart(), straddling.getEnd()});
+        }
+
+        for (auto i = firstToMove; i < ranges.size(); ++i)
+            ranges.getReference(i) += range.getLength();
+
+        updateRunningTotalsFrom(first);
+    }
+
+    //==============================================================================
+    /** Returns the number of contiguous ranges that make up the set. */
+    int getNumRanges() const noexcept { return ranges.size(); }
+
+    /** Returns one of the contiguous ranges that make up the set. */
+    Range<int> getRange(int rangeIndex) const noexcept { return ranges[rangeIndex]; }
+
+    /** Returns the range between the lowest and highest values in the set. */
+    Range<int> getTotalRange() const noexcept {
+        if (ranges.isEmpty())
+            return {};
+
+        return {ranges.getFirst().getStart(), ranges.getLast().getEnd()};
+    }
+
+    /** Returns the ranges that overlap the given range, without copying them.
+        The first and last ranges of the view may extend outside the range asked for.
+    */
+    RangeView getOverlappingRanges(Range<int> range) const noexcept {
+        if (range.isEmpty())
+            return {};
+
+        auto first = findFirstRangeEndingAfter(range.getStart());
+        auto last = findFirstRangeStartingAtOrAfter(range.getEnd());
+
+        return {ranges.begin() + first, ranges.begin() + jmax(first, last)};
+    }
+
+    /** Finds the lowest value in the set that's greater than the one given.
+        Returns false if there isn't one.
+    */
+    bool findNextValueAfter(int value, int &result) const noexcept {
+        for (auto i = findFirstRangeEndingAfter(value); i < ranges.size(); ++i) {
+            auto &r = ranges.getReference(i);
+
+            if (r.getStart() > value) {
+                result = r.getStart();
+                return true;
+            }
+
+            if (value < r.getEnd() - 1) {
+                result = value + 1;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /** Finds the highest value in the set that's less than the one given.
+        Returns false if there isn't one.
+    */
+    bool findPreviousValueBefore(int value, int &result) const noexcept {
+        auto i = findFirstRangeStartingAtOrAfter(value) - 1;
+
+        if (i < 0)
+            return false;
+
+        result = jmin(ranges.getReference(i).getEnd() - 1, value - 1);
+        return true;
+    }
+
+    /** Returns the values inside the given range that are not in this set. */
+    IntervalSet getComplement(Range<int> within) const {
+        IntervalSet result;
+        auto pos = within.getStart();
+
+        for (auto &r : getOverlappingRanges(within)) {
+            if (r.getStart() > pos)
+                result.addRange({pos, r.getStart()});
+
+            pos = jmax(pos, r.getEnd());
+        }
+
+        if (pos < within.getEnd())
+            result.addRange({pos, within.getEnd()});
+
+        return result;
+    }
+
+    const Range<int> *begin() const noexcept { return ranges.begin(); }
+
+    const Range<int> *end() const noexcept { return ranges.end(); }
+
+    /** Makes a SparseSet copy of this set, for APIs that need one.
+        This takes time proportional to the number of ranges.
+    */
+    SparseSet<int> toSparseSet() const {
+        SparseSet<int> result;
+
+        if (ranges.isEmpty())
+            return result;
+
+        // SparseSet::addRange() re-sorts all its ranges every time, so adding them one by one
+        // would be quadratic. Instead, this adds the whole span and cuts the gaps out of it in
+        // ascending order, so that each removeRange() only ever has to look at the last range.
+        result.addRange(getTotalRange());
+
+        for (int i = 1; i < ranges.size(); ++i)
+            result.removeRange({ranges.getReference(i - 1).getEnd(), ranges.getReference(i).getStart()});
+
+        return result;
+    }
+
+    bool operator==(const IntervalSet &other) const noexcept { return ranges == other.ranges; }
+
+    bool operator!=(const IntervalSet &other) const noexcept { return !operator==(other); }
+
+private:
+    //==============================================================================
+    Array<Range<int>> ranges;
+    Array<int> runningTotals; // runningTotals[i] = number of values in ranges[0..i]
+
+    int findFirstRangeEndingAfter(int value) const noexcept {
+        return (int) (std::partition_point(ranges.begin(), ranges.end(),
+                                           [value](const Range<int> &r) { return r.getEnd() <= value; })
+                      - ranges.begin());
+    }
+
+    int findFirstRangeEndingAtOrAfter(int value) const noexcept {
+        return (int) (std::partition_point(ranges.begin(), ranges.end(),
+                                           [value](const Range<int> &r) { return r.getEnd() < value; })
+                      - ranges.begin());
+    }
+
+    int findFirstRangeStartingAfter(int value) const noexcept {
+        return (int) (std::partition_point(ranges.begin(), ranges.end(),
+                                           [value](const Range<int> &r) { return r.getStart() <= value; })
+                      - ranges.begin());
+    }
+
+    int findFirstRangeStartingAtOrAfter(int value) const noexcept {
+        return (int) (std::partition_point(ranges.begin(), ranges.end(),
+                                           [value](const Range<int> &r) { return r.getStart() < value; })
+                      - ranges.begin());
+    }
+
+    void updateRunningTotalsFrom(int index) {
+        runningTotals.resize(ranges.size());
+
+        auto total = index > 0 ? runningTotals.getUnchecked(index - 1) : 0;
+
+        for (int i = index; i < ranges.size(); ++i) {
+            total += ranges.getReference(i).getLength();
+            runningTotals.setUnchecked(i, total);
+        }
+    }
+
+    JUCE_LEAK_DETECTOR (IntervalSet)
+};
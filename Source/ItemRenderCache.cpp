@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    ItemRenderCache.cpp
+    Created: 18 Oct 2026 7:31:52pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ItemRenderCache.h"
+
+ItemRenderCache::ItemRenderCache(const int64 maxBytes) : images(maxBytes) {}
+
+ItemRenderCache::~ItemRenderCache() {}
+
+//==============================================================================
+void ItemRenderCache::invalidate(const void *source, const int64 item) {
+    images.removeIf([source, item](const Key &k) { return k.source == source && k.item == item; });
+}
+
+void ItemRenderCache::invalidateRange(const void *source, const Range<int64> items) {
+    images.removeIf([source, items](const Key &k) { return k.source == source && items.contains(k.item); });
+}
+
+void ItemRenderCache::invalidateAll(const void *source) {
+    images.removeIf([source](const Key &k) { return k.source == source; });
+}
+
+void ItemRenderCache::clear() {
+    images.clear();
+}
+
+//==============================================================================
+size_t ItemRenderCache::KeyHash::operator()(const Key &k) const noexcept {
+    auto h = (size_t) (pointer_sized_uint) k.source * 31 + (size_t) k.item;
+
+    for (auto v : { k.width, k.height, k.scalePercent, (int) k.selected })
+        h = h * 31 + (size_t) v;
+
+    return h;
+}
+
+int64 ItemRenderCache::ImageSize::operator()(const Image &image) const noexcept {
+    return image.isValid() ? (int64) image.getWidth() * image.getHeight() * 4 : 0;
+}
@@ -0,0 +1,137 @@
+/*
+  ==============================================================================
+
+    ItemRenderCache.h
+    Created: 18 Oct 2026 7:31:52pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "LruCache.h"
+
+/**
+    A cache of painted list items, so that an item which scrolls back into view, or
+    is shown by more than one list, only has to be painted by its model once.
+
+    Give it to a list with HorizontalListBox::setRenderCache(). Several lists can share
+    one cache; entries are keyed by the model as well as the item, so lists with
+    different models don't get each other's items. Only items painted in full detail
+    are cached, at the display's physical pixel scale, and the list paints straight to
+    the screen while a zoom is being animated.
+
+    The list throws away the entries of items it's told have changed or moved: an
+    item's when repaintCol() or colChanged() is called, and those of items past the
+    end when updateContent() finds fewer than before. Items that are known by index
+    rather than by ID are also thrown away when colsInserted(), colsRemoved(),
+    colMoved() or colsRemovedFromStart() shifts them, and all of them when
+    allColsChanged() is called. Items with IDs are cached by ID, so they keep their
+    images when they move, and allColsChanged() only throws away those of items whose
+    IDs have gone. Just setting a list's model doesn't touch the cache, so a list that's given
+    a model again can draw from what was cached for it before. A model that changes
+    how an item looks in any other way should call invalidate() itself.
+
+    This must only be used on the message thread.
+*/
+class ItemRenderCache {
+public:
+    /** Creates a cache that holds up to this many bytes of images. */
+    explicit ItemRenderCache(int64 maxBytes = 64 * 1024 * 1024);
+
+    ~ItemRenderCache();
+
+    //==============================================================================
+    /** Draws an item at the origin of a Graphics context, from the cache if it's there,
+        or else by calling paintItem(Graphics &) to paint it into a new image, which is
+        then cached. The source is what the item belongs to, usually its model, and the
+        item can be its index or any other number that identifies it, e.g. an ID.
+
+        If the context has been scaled by a transform that's being animated, pass that
+        scale as transformScale: the image is then painted as if it weren't there, and
+        the same image is scaled down for every step of the animation.
+    */
+    template <typename PaintFunction>
+    void draw(Graphics &g, const void *source, const int64 item, const int width, const int height,
+              const bool selected, PaintFunction &&paintItem, const float transformScale = 1.0f) {
+        if (width <= 0 || height <= 0)
+            return;
+
+        const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor() / jmax(0.01f, transformScale);
+        const Key key{source, item, width, height, roundToInt(scale * 100.0f), selected};
+        auto image = images.find(key);
+
+        if (!image.isValid()) {
+            image = Image(Image::ARGB, jmax(1, roundToInt(width * scale)), jmax(1, roundToInt(height * scale)), true);
+
+            {
+                Graphics imageG(image);
+                imageG.addTransform(AffineTransform::scale(scale));
+                paintItem(imageG);
+            }
+
+            images.add(key, image);
+        }
+
+        g.drawImage(image, Rectangle<float>((float) width, (float) height));
+    }
+
+    //==============================================================================
+    /** Removes all the images of one item. */
+    void invalidate(const void *source, int64 item);
+
+    /** Removes all the images of the items in a range. */
+    void invalidateRange(const void *source, Range<int64> items);
+
+    /** Removes all the images of a source's items that a predicate returns true for,
+        checking the whole cache once however many items there are.
+    */
+    template <typename Predicate>
+    void invalidateIf(const void *source, Predicate &&shouldRemove) {
+        images.removeIf([&](const Key &k) { return k.source == source && shouldRemove(k.item); });
+    }
+
+    /** Removes all the images from one source. */
+    void invalidateAll(const void *source);
+
+    /** Removes all the images. */
+    void clear();
+
+    //==============================================================================
+    /** Sets the most bytes of images to keep. */
+    void setMaxBytes(int64 newMaxBytes) { images.setMaxBytes(newMaxBytes); }
+
+    /** Returns the limit set with setMaxBytes(). */
+    int64 getMaxBytes() const noexcept { return images.getMaxBytes(); }
+
+    /** Returns the number of bytes of images currently held. */
+    int64 getNumBytes() const noexcept { return images.getNumBytes(); }
+
+private:
+    //==============================================================================
+    struct Key {
+        const void *source;
+        int64 item;
+        int width, height, scalePercent;
+        bool selected;
+
+        bool operator==(const Key &other) const noexcept {
+            return source == other.source && item == other.item && width == other.width
+                   && height == other.height && scalePercent == other.scalePercent && selected == other.selected;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &k) const noexcept;
+    };
+
+    struct ImageSize {
+        int64 operator()(const Image &image) const noexcept;
+    };
+
+    LruCache<Key, Image, ImageSize, KeyHash> images;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ItemRenderCache)
+};
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+
+    LatencyHistogram.h
+    Created: 18 Oct 2026 7:28:21pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+    Counts durations in log-linear buckets, so that percentiles can be read back
+    without keeping every sample.
+
+    Durations are recorded in whole microseconds. Below 16us each value has its own
+    bucket; above that, every power of two is split into 8 equal buckets, so a
+    percentile is never more than 1/8 (12.5%) away from a real duration, from a few
+    microseconds to days. Adding a value doesn't allocate, and the whole histogram is
+    a fixed array of about 2KB.
+
+    This isn't thread-safe.
+*/
+class LatencyHistogram {
+public:
+    LatencyHistogram() { clear(); }
+
+    /** Adds a duration, in milliseconds. */
+    void add(const double milliseconds) noexcept {
+        const auto micros = (uint64) jmax(0.0, milliseconds * 1000.0 + 0.5);
+
+        ++counts[(size_t) getBucket(micros)];
+        ++numValues;
+        totalMs += milliseconds;
+        maxMs = jmax(maxMs, milliseconds);
+    }
+
+    /** Removes all the values. */
+    void clear() noexcept {
+        std::fill(std::begin(counts), std::end(counts), 0u);
+        numValues = 0;
+        totalMs = maxMs = 0;
+    }
+
+    //==============================================================================
+    /** Returns the number of values added. */
+    uint64 getNumValues() const noexcept { return numValues; }
+
+    /** Returns the longest duration added, in milliseconds. */
+    double getMax() const noexcept { return maxMs; }
+
+    /** Returns the average duration, in milliseconds. */
+    double getMean() const noexcept { return numValues > 0 ? totalMs / numValues : 0.0; }
+
+    /** Returns a duration, in milliseconds, that the given proportion (0 to 1) of the
+        values were no longer than, e.g. 0.99 for the 99th percentile.
+    */
+    double getPercentile(const double proportion) const noexcept {
+        if (numValues == 0)
+            return 0;
+
+        const auto target = jmax((uint64) 1, (uint64) std::ceil(jlimit(0.0, 1.0, proportion) * numValues));
+        uint64 seen = 0;
+
+        for (int i = 0; i < numBuckets; ++i) {
+            seen += counts[i];
+
+            // the middle of the bucket, but never more than the real maximum
+            if (seen >= target)
+                return jmin(maxMs, (getBucketStart(i) + getBucketStart(i + 1)) * 0.0005);
+        }
+
+        return maxMs;
+    }
+
+private:
+    //==============================================================================
+    static constexpr int subBucketBits = 3, numLinear = 16, numBuckets = numLinear + 60 * (1 << subBucketBits);
+
+    static int getBucket(const uint64 micros) noexcept {
+        if (micros < (uint64) numLinear)
+            return (int) micros;
+
+        const auto shift = highestBit(micros) - subBucketBits;
+        const auto top = (int) (micros >> shift); // from 8 to 15
+
+        return numLinear + (shift - 1) * (1 << subBucketBits) + top - (1 << subBucketBits);
+    }
+
+    static double getBucketStart(const int bucket) noexcept {
+        if (bucket < numLinear)
+            return bucket;
+
+        const auto shift = (bucket - numLinear) / (1 << subBucketBits) + 1;
+        const auto top = (bucket - numLinear) % (1 << subBucketBits) + (1 << subBucketBits);
+
+        return std::ldexp((double) top, shift);
+    }
+
+    static int highestBit(uint64 n) noexcept {
+        int bit = 0;
+
+        while (n >>= 1)
+            ++bit;
+
+        return bit;
+    }
+
+    uint32 counts[numBuckets];
+    uint64 numValues = 0;
+    double totalMs = 0, maxMs = 0;
+
+    JUCE_LEAK_DETECTOR (LatencyHistogram)
+};
@@ -0,0 +1,412 @@
+/*
+  ==============================================================================
+
+    ListBoxModelView.cpp
+    Created: 18 Oct 2026 7:04:03pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ListBoxModelView.h"
+
+ListBoxModelView::ListBoxModelView(ListBoxModel &modelToView)
+        : source(modelToView), extendedSource(dynamic_cast<HorizontalListBoxModel *>(&modelToView)) {
+    rebuild({});
+}
+
+ListBoxModelView::~ListBoxModelView() {}
+
+//==============================================================================
+void ListBoxModelView::setFilter(Filter newFilter) {
+    filter = std::move(newFilter);
+    rebuild({});
+}
+
+void ListBoxModelView::clearSort() {
+    order.reset();
+    rebuild({});
+}
+
+void ListBoxModelView::sourceItemsChanged(Range<int> sourceItems) {
+    const auto newNumSourceItems = source.getNumRows();
+
+    if (newNumSourceItems < numSourceItems) {
+        sourceContentChanged();
+        return;
+    }
+
+    // the list keeps the images and components of items it already has, so it has to be
+    // told which of them have changed, as opposed to just being added
+    const auto changedItems = sourceItems.getIntersectionWith({0, numSourceItems});
+
+    if (newNumSourceItems > numSourceItems)
+        sourceItems = sourceItems.isEmpty() ? Range<int>(numSourceItems, newNumSourceItems)
+                                            : sourceItems.getUnionWith({numSourceItems, newNumSourceItems});
+
+    sourceItems = sourceItems.getIntersectionWith({0, newNumSourceItems});
+
+    if (sourceItems.isEmpty())
+        return;
+
+    // past a certain point it's quicker to start again than to merge
+    if (sourceItems.getLength() > newNumSourceItems / 8) {
+        rebuild(sourceItems, changedItems);
+        return;
+    }
+
+    // take the changed items out of the view, keeping the rest in their current order..
+    Array<int> unchanged;
+    unchanged.ensureStorageAllocated(viewToSource.size());
+
+    for (auto index : viewToSource)
+        if (!sourceItems.contains(index))
+            unchanged.add(index);
+
+    // ..then merge back in the ones that still pass the filter
+    std::vector<uint8> passes((size_t) sourceItems.getLength(), 1);
+
+    if (order != nullptr)
+        order->setNumItems(newNumSourceItems);
+
+    pool->parallelFor(sourceItems.getLength(), ListWorkerPool::getDefaultChunkSize(sourceItems.getLength()),
+                      [&](Range<int> r) {
+                          if (order != nullptr)
+                              order->extractKeys(r + sourceItems.getStart());
+
+                          if (filter != nullptr)
+                              for (auto i = r.getStart(); i < r.getEnd(); ++i)
+                                  passes[(size_t) i] = filter(i + sourceItems.getStart()) ? 1 : 0;
+                      });
+
+    Array<int> changed;
+
+    for (int i = 0; i < sourceItems.getLength(); ++i)
+        if (passes[(size_t) i] != 0)
+            changed.add(i + sourceItems.getStart());
+
+    sortItems(changed);
+
+    Array<int> merged;
+    merged.resize(unchanged.size() + changed.size());
+
+    std::merge(unchanged.begin(), unchanged.end(), changed.begin(), changed.end(), merged.begin(),
+               [this](int a, int b) { return isBefore(a, b); });
+
+    setMapping(merged, newNumSourceItems);
+    updateListBox(changedItems);
+}
+
+void ListBoxModelView::sourceContentChanged() {
+    ++sourceIndexGeneration;
+    rebuild({0, source.getNumRows()});
+}
+
+//==============================================================================
+int ListBoxModelView::getSourceIndex(const int viewIndex) const noexcept {
+    return isPositiveAndBelow(viewIndex, viewToSource.size()) ? viewToSource.getUnchecked(viewIndex) : -1;
+}
+
+int ListBoxModelView::getViewIndex(const int sourceIndex) const noexcept {
+    return isPositiveAndBelow(sourceIndex, sourceToView.size()) ? sourceToView.getUnchecked(sourceIndex) : -1;
+}
+
+// Rows past the end of the view are passed on as a row past the end of the source, as a
+// ListBoxModel expects for an empty row, and -1 (i.e. no row) is passed on unchanged.
+int ListBoxModelView::getSourceRow(const int viewRow) const {
+    if (viewRow < 0)
+        return -1;
+
+    const auto index = getSourceIndex(viewRow);
+    return index >= 0 ? index : jmax(numSourceItems, source.getNumRows());
+}
+
+IntervalSet ListBoxModelView::viewToSourceIndices(const IntervalSet &viewIndices) const {
+    Array<int> indices;
+
+    for (auto &r : viewIndices.getOverlappingRanges({0, viewToSource.size()}))
+        for (auto i = jmax(0, r.getStart()); i < jmin(viewToSource.size(), r.getEnd()); ++i)
+            indices.add(viewToSource.getUnchecked(i));
+
+    std::sort(indices.begin(), indices.end());
+
+    IntervalSet result;
+
+    for (auto index : indices)
+        result.addRange({index, index + 1});
+
+    return result;
+}
+
+IntervalSet ListBoxModelView::sourceToViewIndices(const IntervalSet &sourceIndices) const {
+    Array<int> indices;
+
+    for (auto &r : sourceIndices.getOverlappingRanges({0, sourceToView.size()}))
+        for (auto i = jmax(0, r.getStart()); i < jmin(sourceToView.size(), r.getEnd()); ++i)
+            if (sourceToView.getUnchecked(i) >= 0)
+                indices.add(sourceToView.getUnchecked(i));
+
+    std::sort(indices.begin(), indices.end());
+
+    IntervalSet result;
+
+    for (auto index : indices)
+        result.addRange({index, index + 1});
+
+    return result;
+}
+
+int ListBoxModelView::findColShowingItem(const HorizontalListBox &list, const ListBoxModel &model,
+                                         const int itemIndex) {
+    return findIndexOfItem(list.getModel(), model, itemIndex);
+}
+
+// Works out where an item of a model is in another model, which is either the same model
+// or a view of it, possibly through other views.
+int ListBoxModelView::findIndexOfItem(const ListBoxModel *shownModel, const ListBoxModel &model,
+                                      const int itemIndex) {
+    if (shownModel == &model)
+        return itemIndex;
+
+    if (auto *view = dynamic_cast<const ListBoxModelView *>(shownModel)) {
+        const auto sourceIndex = findIndexOfItem(&view->getSourceModel(), model, itemIndex);
+        return sourceIndex >= 0 ? view->getViewIndex(sourceIndex) : -1;
+    }
+
+    return -1;
+}
+
+//==============================================================================
+bool ListBoxModelView::isBefore(const int sourceIndex1, const int sourceIndex2) const noexcept {
+    return order != nullptr ? order->isBefore(sourceIndex1, sourceIndex2)
+                            : sourceIndex1 < sourceIndex2;
+}
+
+void ListBoxModelView::rebuild(const Range<int> keysToExtract, const Range<int> changedSourceItems) {
+    const auto newNumSourceItems = source.getNumRows();
+    const auto chunkSize = ListWorkerPool::getDefaultChunkSize(newNumSourceItems);
+
+    if (order != nullptr) {
+        order->setNumItems(newNumSourceItems);
+
+        auto toExtract = keysToExtract.getIntersectionWith({0, newNumSourceItems});
+
+        if (newNumSourceItems > numSourceItems)
+            toExtract = toExtract.isEmpty() ? Range<int>(numSourceItems, newNumSourceItems)
+                                            : toExtract.getUnionWith({numSourceItems, newNumSourceItems});
+
+        pool->parallelFor(toExtract.getLength(), chunkSize, [&](Range<int> r) {
+            order->extractKeys(r + toExtract.getStart());
+        });
+    }
+
+    Array<int> newViewToSource;
+
+    if (filter == nullptr) {
+        newViewToSource.resize(newNumSourceItems);
+
+        for (int i = 0; i < newNumSourceItems; ++i)
+            newViewToSource.setUnchecked(i, i);
+    } else {
+        std::vector<uint8> passes((size_t) newNumSourceItems);
+
+        pool->parallelFor(newNumSourceItems, chunkSize, [&](Range<int> r) {
+            for (auto i = r.getStart(); i < r.getEnd(); ++i)
+                passes[(size_t) i] = filter(i) ? 1 : 0;
+        });
+
+        newViewToSource.ensureStorageAllocated(newNumSourceItems);
+
+        for (int i = 0; i < newNumSourceItems; ++i)
+            if (passes[(size_t) i] != 0)
+                newViewToSource.add(i);
+    }
+
+    sortItems(newViewToSource);
+    setMapping(newViewToSource, newNumSourceItems);
+    updateListBox(changedSourceItems);
+}
+
+void ListBoxModelView::sortItems(Array<int> &sourceIndices) const {
+    if (order == nullptr)
+        return;
+
+    auto less = [this](int a, int b) { return order->isBefore(a, b); };
+
+    const auto numItems = sourceIndices.size();
+    const auto runLength = ListWorkerPool::getDefaultChunkSize(numItems);
+    auto *items = sourceIndices.getRawDataPointer();
+
+    // sort runs of items in parallel..
+    pool->parallelFor(numItems, runLength, [&](Range<int> r) {
+        std::sort(items + r.getStart(), items + r.getEnd(), less);
+    });
+
+    if (numItems <= runLength)
+        return;
+
+    // ..then merge neighbouring runs in parallel, doubling the run length each time
+    Array<int> buffer;
+    buffer.resize(numItems);
+
+    auto *from = items;
+    auto *to = buffer.getRawDataPointer();
+
+    for (int64 width = runLength; width < numItems; width *= 2) {
+        const auto numPairs = (int) ((numItems + 2 * width - 1) / (2 * width));
+
+        pool->parallelFor(numPairs, 1, [&](Range<int> pairs) {
+            for (auto pair = pairs.getStart(); pair < pairs.getEnd(); ++pair) {
+                const auto start = (int) (pair * 2 * width);
+                const auto middle = (int) jmin((int64) numItems, start + width);
+                const auto end = (int) jmin((int64) numItems, start + 2 * width);
+
+                std::merge(from + start, from + middle, from + middle, from + end, to + start, less);
+            }
+        });
+
+        std::swap(from, to);
+    }
+
+    if (from != items)
+        std::copy(from, from + numItems, items);
+}
+
+void ListBoxModelView::setMapping(Array<int> &newViewToSource, const int newNumSourceItems) {
+    Array<int> newSourceToView;
+    newSourceToView.insertMultiple(0, -1, newNumSourceItems);
+
+    for (int i = 0; i < newViewToSource.size(); ++i)
+        newSourceToView.setUnchecked(newViewToSource.getUnchecked(i), i);
+
+    const SpinLock::ScopedLockType sl(mappingLock);
+    viewToSource.swapWith(newViewToSource);
+    sourceToView.swapWith(newSourceToView);
+    numSourceItems = newNumSourceItems;
+}
+
+// The view's items have IDs, so the list moves the selection, the search matches and
+// its cached images to wherever the items are now by itself.
+void ListBoxModelView::updateListBox(const Range<int> changedSourceItems) {
+    if (listBox != nullptr) {
+        listBox->allColsChanged();
+
+        if (!changedSourceItems.isEmpty()) {
+            IntervalSet changed;
+            changed.addRange(changedSourceItems);
+            listBox->colsChanged(sourceToViewIndices(changed));
+        }
+    }
+}
+
+//==============================================================================
+int ListBoxModelView::getNumRows() {
+    return viewToSource.size();
+}
+
+void ListBoxModelView::paintListBoxItem(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected) {
+    const auto index = getSourceIndex(rowNumber);
+
+    if (index >= 0)
+        source.paintListBoxItem(index, g, width, height, rowIsSelected);
+}
+
+void ListBoxModelView::paintListBoxItemWithDetail(int rowNumber, Graphics &g, int width, int height,
+                                                  bool rowIsSelected, DetailLevel detail) {
+    if (extendedSource == nullptr) {
+        paintListBoxItem(rowNumber, g, width, height, rowIsSelected);
+        return;
+    }
+
+    const auto index = getSourceIndex(rowNumber);
+
+    if (index >= 0)
+        extendedSource->paintListBoxItemWithDetail(index, g, width, height, rowIsSelected, detail);
+}
+
+Component *ListBoxModelView::refreshComponentForRow(int rowNumber, bool isRowSelected,
+                                                    Component *existingComponentToUpdate) {
+    return source.refreshComponentForRow(getSourceRow(rowNumber), isRowSelected, existingComponentToUpdate);
+}
+
+void ListBoxModelView::listBoxItemClicked(int row, const MouseEvent &e) {
+    source.listBoxItemClicked(getSourceRow(row), e);
+}
+
+void ListBoxModelView::listBoxItemDoubleClicked(int row, const MouseEvent &e) {
+    source.listBoxItemDoubleClicked(getSourceRow(row), e);
+}
+
+void ListBoxModelView::backgroundClicked(const MouseEvent &e) {
+    source.backgroundClicked(e);
+}
+
+void ListBoxModelView::selectedRowsChanged(int lastRowSelected) {
+    source.selectedRowsChanged(getSourceRow(lastRowSelected));
+}
+
+void ListBoxModelView::deleteKeyPressed(int lastRowSelected) {
+    source.deleteKeyPressed(getSourceRow(lastRowSelected));
+}
+
+void ListBoxModelView::returnKeyPressed(int lastRowSelected) {
+    source.returnKeyPressed(getSourceRow(lastRowSelected));
+}
+
+void ListBoxModelView::listWasScrolled() {
+    source.listWasScrolled();
+}
+
+var ListBoxModelView::getDragSourceDescription(const SparseSet<int> &rowsToDescribe) {
+    return source.getDragSourceDescription(viewToSourceIndices(IntervalSet(rowsToDescribe)).toSparseSet());
+}
+
+String ListBoxModelView::getTooltipForRow(int row) {
+    return source.getTooltipForRow(getSourceRow(row));
+}
+
+MouseCursor ListBoxModelView::getMouseCursorForRow(int row) {
+    return source.getMouseCursorForRow(getSourceRow(row));
+}
+
+// Items are identified by the source's IDs if it has them, or else by their source
+// index, so the list can follow them when the view is filtered or sorted again.
+int64 ListBoxModelView::getItemId(int colNumber) {
+    const auto index = getSourceIndex(colNumber);
+
+    if (index < 0)
+        return -1;
+
+    const auto id = extendedSource != nullptr ? extendedSource->getItemId(index) : (int64) -1;
+    return id >= 0 ? id : (sourceIndexGeneration << 32) + index;
+}
+
+void ListBoxModelView::visibleColsChanged(const Range<int> visibleCols, const Range<int> colsToPrefetch,
+                                          const int colWidth, const int colHeight) {
+    if (extendedSource != nullptr)
+        extendedSource->visibleItemsChanged(viewToSourceIndices(IntervalSet(visibleCols)),
+                                            viewToSourceIndices(IntervalSet(colsToPrefetch)),
+                                            getSourceIndex(visibleCols.getStart() + visibleCols.getLength() / 2),
+                                            colWidth, colHeight);
+}
+
+void ListBoxModelView::visibleItemsChanged(const IntervalSet &visibleItems, const IntervalSet &itemsToPrefetch,
+                                           const int centreItem, const int colWidth, const int colHeight) {
+    if (extendedSource != nullptr)
+        extendedSource->visibleItemsChanged(viewToSourceIndices(visibleItems), viewToSourceIndices(itemsToPrefetch),
+                                            getSourceIndex(centreItem), colWidth, colHeight);
+}
+
+String ListBoxModelView::getTextForCol(int colNumber) {
+    if (extendedSource == nullptr)
+        return {};
+
+    int index;
+
+    {
+        const SpinLock::ScopedLockType sl(mappingLock);
+        index = getSourceIndex(colNumber);
+    }
+
+    return index >= 0 ? extendedSource->getTextForCol(index) : String();
+}
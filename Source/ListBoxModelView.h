@@ -0,0 +1,262 @@
+/*
+  ==============================================================================
+
+    ListBoxModelView.h
+    Created: 18 Oct 2026 7:04:03pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBox.h"
+#include "ListWorkerPool.h"
+
+/**
+    A model that shows a sorted and/or filtered view of another ListBoxModel.
+
+    The view doesn't copy any of the source model's data - all it keeps is the list of
+    source indices that it's showing, in display order, and the reverse mapping. Every
+    ListBoxModel callback is forwarded to the source model with the index translated.
+
+    Filters and sort keys are evaluated in parallel on the ListWorkerPool, so they'll be
+    called from several threads at once and must be safe to use that way. Sort keys are
+    extracted once per item and kept, so comparisons don't call back into the model.
+
+    If you give it the HorizontalListBox that's displaying it with setListBox(), the view
+    will update the list whenever it changes, keeping the same source items selected,
+    and bringing any search up to date. Items are followed by the source's item IDs if
+    it has them, or else by their source index, which can't be followed through
+    sourceContentChanged(), so a source without IDs loses its selection then.
+
+    @code
+    ListBoxModelView view { sourceModel };
+    view.setListBox(&list);
+    list.setModel(&view);
+
+    view.setFilter([&](int i) { return sourceModel.isVisible(i); });
+    view.sortBy([&](int i) { return sourceModel.getName(i); });
+    @endcode
+*/
+class ListBoxModelView : public HorizontalListBoxModel {
+public:
+    explicit ListBoxModelView(ListBoxModel &modelToView);
+
+    ~ListBoxModelView() override;
+
+    /** Returns the model that's being viewed. */
+    ListBoxModel &getSourceModel() const noexcept { return source; }
+
+    /** Sets the list that should be updated when the view changes.
+        The list should be using this view as its model.
+    */
+    void setListBox(HorizontalListBox *listToUpdate) noexcept { listBox = listToUpdate; }
+
+    //==============================================================================
+    /** Called with a source index, and returns true if the item should be shown. */
+    using Filter = std::function<bool(int)>;
+
+    /** Changes the filter, re-evaluating it for every item.
+        Pass nullptr to show all the source model's items.
+    */
+    void setFilter(Filter newFilter);
+
+    /** Sorts the items by a key that's extracted from each of them.
+
+        The key function is called once for each source index; the keys are kept and
+        compared with the comparator, and items with equal keys stay in source order.
+
+        @code
+        view.sortBy([&](int i) { return model.items[i].date; }, std::greater<>());
+        @endcode
+    */
+    template <typename KeyFunction, typename Comparator = std::less<>>
+    void sortBy(KeyFunction getKeyForItem, Comparator comparator = Comparator()) {
+        using KeyType = typename std::decay<decltype(getKeyForItem(0))>::type;
+        order.reset(new KeyedOrder<KeyType, KeyFunction, Comparator>(std::move(getKeyForItem),
+                                                                     std::move(comparator)));
+        rebuild({0, source.getNumRows()});
+    }
+
+    /** Goes back to showing the items in the source model's order. */
+    void clearSort();
+
+    //==============================================================================
+    /** Tells the view that some of the source model's items have changed, or been
+        appended, so that only those items have their filter and sort key re-evaluated.
+
+        Any items beyond the end of the source model's previous size are treated as
+        new ones, even if they're not in the range you pass in.
+    */
+    void sourceItemsChanged(Range<int> sourceItems);
+
+    /** Tells the view that the source model has changed in a way that moves items to
+        different indices, e.g. items have been removed or reordered, so everything
+        needs to be re-evaluated.
+    */
+    void sourceContentChanged();
+
+    //==============================================================================
+    /** Returns the number of items in the view. */
+    int getNumItems() const noexcept { return viewToSource.size(); }
+
+    /** Returns the source index of an item in the view, or -1 if it's out of range. */
+    int getSourceIndex(int viewIndex) const noexcept;
+
+    /** Returns the view index of a source item, or -1 if it's filtered out. */
+    int getViewIndex(int sourceIndex) const noexcept;
+
+    /** Converts a set of view indices to the source indices they show. */
+    IntervalSet viewToSourceIndices(const IntervalSet &viewIndices) const;
+
+    /** Converts a set of source indices to view indices, leaving out any items that
+        are filtered out.
+    */
+    IntervalSet sourceToViewIndices(const IntervalSet &sourceIndices) const;
+
+    /** Returns the column of a list that's showing an item from a model, where the list
+        may be showing the model directly or through one or more ListBoxModelViews.
+        Returns -1 if the item isn't in the list, e.g. because it's been filtered out.
+
+        A model that repaints its own columns, e.g. when something it loads in the
+        background arrives, can use this to find them.
+    */
+    static int findColShowingItem(const HorizontalListBox &list, const ListBoxModel &model, int itemIndex);
+
+    //==============================================================================
+    /** @internal */
+    int getNumRows() override;
+
+    /** @internal */
+    void paintListBoxItem(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected) override;
+
+    /** @internal */
+    void paintListBoxItemWithDetail(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected,
+                                    DetailLevel detail) override;
+
+    /** @internal */
+    Component *refreshComponentForRow(int rowNumber, bool isRowSelected, Component *existingComponentToUpdate) override;
+
+    /** @internal */
+    void listBoxItemClicked(int row, const MouseEvent &e) override;
+
+    /** @internal */
+    void listBoxItemDoubleClicked(int row, const MouseEvent &e) override;
+
+    /** @internal */
+    void backgroundClicked(const MouseEvent &e) override;
+
+    /** @internal */
+    void selectedRowsChanged(int lastRowSelected) override;
+
+    /** @internal */
+    void deleteKeyPressed(int lastRowSelected) override;
+
+    /** @internal */
+    void returnKeyPressed(int lastRowSelected) override;
+
+    /** @internal */
+    void listWasScrolled() override;
+
+    /** @internal */
+    var getDragSourceDescription(const SparseSet<int> &rowsToDescribe) override;
+
+    /** @internal */
+    String getTooltipForRow(int row) override;
+
+    /** @internal */
+    MouseCursor getMouseCursorForRow(int row) override;
+
+    /** @internal */
+    String getTextForCol(int colNumber) override;
+
+    /** @internal */
+    int64 getItemId(int colNumber) override;
+
+    /** @internal */
+    void visibleColsChanged(Range<int> visibleCols, Range<int> colsToPrefetch, int colWidth, int colHeight) override;
+
+    /** @internal */
+    void visibleItemsChanged(const IntervalSet &visibleItems, const IntervalSet &itemsToPrefetch,
+                             int centreItem, int colWidth, int colHeight) override;
+
+private:
+    //==============================================================================
+    struct Order {
+        virtual ~Order() = default;
+
+        virtual void setNumItems(int numItems) = 0;
+
+        // this is called concurrently for different ranges
+        virtual void extractKeys(Range<int> sourceItems) = 0;
+
+        virtual bool isBefore(int sourceIndex1, int sourceIndex2) const noexcept = 0;
+    };
+
+    template <typename KeyType, typename KeyFunction, typename Comparator>
+    struct KeyedOrder : public Order {
+        // std::vector<bool> packs its elements, so they can't be written from several threads
+        static_assert(!std::is_same<KeyType, bool>::value, "Sorting by a bool key isn't supported");
+
+        KeyedOrder(KeyFunction f, Comparator c) : getKey(std::move(f)), comparator(std::move(c)) {}
+
+        void setNumItems(int numItems) override { keys.resize((size_t) numItems); }
+
+        void extractKeys(Range<int> sourceItems) override {
+            for (auto i = sourceItems.getStart(); i < sourceItems.getEnd(); ++i)
+                keys[(size_t) i] = getKey(i);
+        }
+
+        bool isBefore(int sourceIndex1, int sourceIndex2) const noexcept override {
+            auto &key1 = keys[(size_t) sourceIndex1];
+            auto &key2 = keys[(size_t) sourceIndex2];
+
+            if (comparator(key1, key2))
+                return true;
+
+            if (comparator(key2, key1))
+                return false;
+
+            return sourceIndex1 < sourceIndex2;
+        }
+
+        KeyFunction getKey;
+        Comparator comparator;
+        std::vector<KeyType> keys;
+    };
+
+    ListBoxModel &source;
+    HorizontalListBoxModel *extendedSource;
+    Component::SafePointer<HorizontalListBox> listBox;
+    std::unique_ptr<Order> order;
+    Filter filter;
+    SharedResourcePointer<ListWorkerPool> pool;
+
+    // getTextForCol() is called on the search threads, so the mapping is only ever
+    // swapped while holding this lock
+    SpinLock mappingLock;
+    Array<int> viewToSource, sourceToView;
+    int numSourceItems = 0;
+
+    // a source without item IDs has its items identified by index, which only lasts until
+    // sourceContentChanged() moves them, so this is put into the IDs to make them new ones
+    int64 sourceIndexGeneration = 0;
+
+    bool isBefore(int sourceIndex1, int sourceIndex2) const noexcept;
+
+    int getSourceRow(int viewRow) const;
+
+    static int findIndexOfItem(const ListBoxModel *shownModel, const ListBoxModel &model, int itemIndex);
+
+    void rebuild(Range<int> keysToExtract, Range<int> changedSourceItems = {});
+
+    void sortItems(Array<int> &sourceIndices) const;
+
+    void setMapping(Array<int> &newViewToSource, int newNumSourceItems);
+
+    void updateListBox(Range<int> changedSourceItems);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListBoxModelView)
+};
@@ -0,0 +1,395 @@
+/*
+  ==============================================================================
+
+    ListInputTrace.cpp
+    Created: 18 Oct 2026 7:25:09pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ListInputTrace.h"
+
+namespace {
+    const char traceMagic[] = "HLTR";
+    // version 2 added the events for the list's other content changes, so version 1
+    // traces are still read as they were
+    const int traceVersion = 2;
+
+    enum WheelFlags {
+        wheelReversed = 1,
+        wheelSmooth = 2,
+        wheelInertial = 4
+    };
+}
+
+using EventType = ListInputTrace::Event::Type;
+
+//==============================================================================
+void ListInputTrace::add(const Event &event) {
+    jassert(events.empty() || event.time >= events.back().time);
+    events.push_back(event);
+}
+
+bool ListInputTrace::writeTo(OutputStream &out) const {
+    out.write(traceMagic, 4);
+    out.writeCompressedInt(traceVersion);
+    out.writeCompressedInt((int) events.size());
+
+    // times are stored as the gap since the last event, in microseconds, which
+    // usually fits in two or three bytes
+    int64 lastMicros = 0;
+
+    for (auto &e : events) {
+        const auto micros = (int64) std::llround(e.time * 1000.0);
+
+        out.writeByte((char) e.type);
+        out.writeCompressedInt((int) jmin((int64) std::numeric_limits<int>::max(), micros - lastMicros));
+        lastMicros = micros;
+
+        switch (e.type) {
+            case EventType::mouseDown:
+            case EventType::mouseUp:
+                out.writeCompressedInt(e.numClicks);
+                // fall through
+            case EventType::mouseDrag:
+            case EventType::mouseMove:
+                out.writeCompressedInt(e.position.x);
+                out.writeCompressedInt(e.position.y);
+                out.writeCompressedInt(e.mods);
+                break;
+
+            case EventType::wheel:
+                out.writeCompressedInt(e.position.x);
+                out.writeCompressedInt(e.position.y);
+                out.writeCompressedInt(e.mods);
+                out.writeFloat(e.wheel.deltaX);
+                out.writeFloat(e.wheel.deltaY);
+                out.writeByte((char) ((e.wheel.isReversed ? wheelReversed : 0)
+                                      | (e.wheel.isSmooth ? wheelSmooth : 0)
+                                      | (e.wheel.isInertial ? wheelInertial : 0)));
+                break;
+
+            case EventType::key:
+                out.writeCompressedInt(e.keyCode);
+                out.writeCompressedInt(e.mods);
+                out.writeCompressedInt((int) e.textCharacter);
+                break;
+
+            case EventType::resize:
+                out.writeCompressedInt(e.width);
+                out.writeCompressedInt(e.height);
+                break;
+
+            case EventType::contentUpdated:
+            case EventType::colsRemovedFromStart:
+            case EventType::allColsChanged:
+                out.writeCompressedInt(e.numCols);
+                break;
+
+            case EventType::colsInserted:
+            case EventType::colsRemoved:
+            case EventType::colsChanged:
+                out.writeCompressedInt(e.cols.getStart());
+                out.writeCompressedInt(e.cols.getLength());
+                break;
+
+            case EventType::colChanged:
+                out.writeCompressedInt(e.cols.getStart());
+                break;
+
+            case EventType::colMoved:
+                out.writeCompressedInt(e.oldIndex);
+                out.writeCompressedInt(e.newIndex);
+                break;
+        }
+    }
+
+    return out.getStatus().wasOk();
+}
+
+bool ListInputTrace::readFrom(InputStream &in) {
+    events.clear();
+    char magic[4];
+
+    if (in.read(magic, 4) != 4 || memcmp(magic, traceMagic, 4) != 0)
+        return false;
+
+    const auto version = in.readCompressedInt();
+
+    if (version < 1 || version > traceVersion)
+        return false;
+
+    const auto numEvents = in.readCompressedInt();
+
+    if (numEvents < 0)
+        return false;
+
+    std::vector<Event> newEvents;
+    newEvents.reserve((size_t) jmin(numEvents, 1 << 20));
+    int64 micros = 0;
+
+    for (int i = 0; i < numEvents; ++i) {
+        if (in.isExhausted())
+            return false;
+
+        Event e;
+        const auto type = (uint8) in.readByte();
+
+        if (type > (uint8) (version == 1 ? EventType::colsRemovedFromStart : EventType::allColsChanged))
+            return false;
+
+        e.type = (EventType) type;
+        micros += jmax(0, in.readCompressedInt());
+        e.time = micros / 1000.0;
+
+        switch (e.type) {
+            case EventType::mouseDown:
+            case EventType::mouseUp:
+                e.numClicks = in.readCompressedInt();
+                // fall through
+            case EventType::mouseDrag:
+            case EventType::mouseMove:
+                e.position.x = in.readCompressedInt();
+                e.position.y = in.readCompressedInt();
+                e.mods = in.readCompressedInt();
+                break;
+
+            case EventType::wheel: {
+                e.position.x = in.readCompressedInt();
+                e.position.y = in.readCompressedInt();
+                e.mods = in.readCompressedInt();
+                e.wheel.deltaX = in.readFloat();
+                e.wheel.deltaY = in.readFloat();
+
+                const auto flags = in.readByte();
+                e.wheel.isReversed = (flags & wheelReversed) != 0;
+                e.wheel.isSmooth = (flags & wheelSmooth) != 0;
+                e.wheel.isInertial = (flags & wheelInertial) != 0;
+                break;
+            }
+
+            case EventType::key:
+                e.keyCode = in.readCompressedInt();
+                e.mods = in.readCompressedInt();
+                e.textCharacter = (juce_wchar) in.readCompressedInt();
+                break;
+
+            case EventType::resize:
+                e.width = in.readCompressedInt();
+                e.height = in.readCompressedInt();
+                break;
+
+            case EventType::contentUpdated:
+            case EventType::colsRemovedFromStart:
+            case EventType::allColsChanged:
+                e.numCols = in.readCompressedInt();
+                break;
+
+            case EventType::colsInserted:
+            case EventType::colsRemoved:
+            case EventType::colsChanged: {
+                const auto start = in.readCompressedInt();
+                e.cols = Range<int>::withStartAndLength(start, jmax(0, in.readCompressedInt()));
+                break;
+            }
+
+            case EventType::colChanged: {
+                const auto col = in.readCompressedInt();
+                e.cols = {col, col + 1};
+                break;
+            }
+
+            case EventType::colMoved:
+                e.oldIndex = in.readCompressedInt();
+                e.newIndex = in.readCompressedInt();
+                break;
+        }
+
+        newEvents.push_back(e);
+    }
+
+    events.swap(newEvents);
+    return true;
+}
+
+bool ListInputTrace::save(const File &file) const {
+    TemporaryFile temp(file);
+
+    {
+        FileOutputStream out(temp.getFile());
+
+        if (out.failedToOpen() || !writeTo(out))
+            return false;
+
+        out.flush();
+
+        if (out.getStatus().failed())
+            return false;
+    }
+
+    return temp.overwriteTargetFileWithTemporary();
+}
+
+bool ListInputTrace::load(const File &file) {
+    FileInputStream in(file);
+
+    if (in.failedToOpen()) {
+        events.clear();
+        return false;
+    }
+
+    return readFrom(in);
+}
+
+ListInputTrace ListInputTrace::createResizeTrace(const Range<int> widths, const int height,
+                                                const int numSweeps, const int stepSize) {
+    ListInputTrace trace;
+    Event e;
+    e.type = Event::Type::resize;
+    e.height = height;
+
+    auto addStep = [&trace, &e](const int width) {
+        e.width = width;
+        trace.add(e);
+        e.time += 1000.0 / 60.0;
+    };
+
+    const auto step = jmax(1, stepSize);
+
+    for (int sweep = 0; sweep < numSweeps; ++sweep) {
+        for (auto w = widths.getEnd(); w > widths.getStart(); w -= step)
+            addStep(w);
+
+        for (auto w = widths.getStart(); w < widths.getEnd(); w += step)
+            addStep(w);
+    }
+
+    addStep(widths.getEnd());
+    return trace;
+}
+
+//==============================================================================
+ListInputRecorder::ListInputRecorder(HorizontalListBox &listToRecord)
+        : list(listToRecord), startTime(Time::getMillisecondCounterHiRes()) {
+    list.addMouseListener(this, true);
+    list.addKeyListener(this);
+    list.addComponentListener(this);
+    list.addListener(this);
+
+    // the replay starts from the same size and content
+    componentMovedOrResized(list, false, true);
+    listContentUpdated(list, list.getModel() != nullptr ? list.getModel()->getNumRows() : 0);
+}
+
+ListInputRecorder::~ListInputRecorder() {
+    list.removeListener(this);
+    list.removeComponentListener(this);
+    list.removeKeyListener(this);
+    list.removeMouseListener(this);
+}
+
+void ListInputRecorder::addEvent(ListInputTrace::Event &event) {
+    event.time = Time::getMillisecondCounterHiRes() - startTime;
+    trace.add(event);
+}
+
+void ListInputRecorder::addMouseEvent(const ListInputTrace::Event::Type type, const MouseEvent &e) {
+    ListInputTrace::Event event;
+    event.type = type;
+    event.position = e.getEventRelativeTo(&list).getPosition();
+    event.mods = e.mods.getRawFlags();
+    event.numClicks = e.getNumberOfClicks();
+    addEvent(event);
+}
+
+void ListInputRecorder::mouseDown(const MouseEvent &e) { addMouseEvent(EventType::mouseDown, e); }
+
+void ListInputRecorder::mouseDrag(const MouseEvent &e) { addMouseEvent(EventType::mouseDrag, e); }
+
+void ListInputRecorder::mouseUp(const MouseEvent &e) { addMouseEvent(EventType::mouseUp, e); }
+
+void ListInputRecorder::mouseMove(const MouseEvent &e) { addMouseEvent(EventType::mouseMove, e); }
+
+void ListInputRecorder::mouseWheelMove(const MouseEvent &e, const MouseWheelDetails &wheel) {
+    ListInputTrace::Event event;
+    event.type = EventType::wheel;
+    event.position = e.getEventRelativeTo(&list).getPosition();
+    event.mods = e.mods.getRawFlags();
+    event.wheel = wheel;
+    addEvent(event);
+}
+
+bool ListInputRecorder::keyPressed(const KeyPress &key, Component *) {
+    ListInputTrace::Event event;
+    event.type = EventType::key;
+    event.keyCode = key.getKeyCode();
+    event.mods = key.getModifiers().getRawFlags();
+    event.textCharacter = key.getTextCharacter();
+    addEvent(event);
+
+    return false;
+}
+
+void ListInputRecorder::componentMovedOrResized(Component &component, bool, const bool wasResized) {
+    if (wasResized) {
+        ListInputTrace::Event event;
+        event.type = EventType::resize;
+        event.width = component.getWidth();
+        event.height = component.getHeight();
+        addEvent(event);
+    }
+}
+
+void ListInputRecorder::listContentUpdated(HorizontalListBox &, const int numCols) {
+    ListInputTrace::Event event;
+    event.type = EventType::contentUpdated;
+    event.numCols = numCols;
+    addEvent(event);
+}
+
+void ListInputRecorder::listColsRemovedFromStart(HorizontalListBox &, const int numRemoved) {
+    ListInputTrace::Event event;
+    event.type = EventType::colsRemovedFromStart;
+    event.numCols = numRemoved;
+    addEvent(event);
+}
+
+void ListInputRecorder::listAllColsChanged(HorizontalListBox &, const int numCols) {
+    ListInputTrace::Event event;
+    event.type = EventType::allColsChanged;
+    event.numCols = numCols;
+    addEvent(event);
+}
+
+void ListInputRecorder::listColsInserted(HorizontalListBox &, const int startIndex, const int numInserted) {
+    addColsEvent(EventType::colsInserted, Range<int>::withStartAndLength(startIndex, numInserted));
+}
+
+void ListInputRecorder::listColsRemoved(HorizontalListBox &, const int startIndex, const int numRemoved) {
+    addColsEvent(EventType::colsRemoved, Range<int>::withStartAndLength(startIndex, numRemoved));
+}
+
+void ListInputRecorder::listColMoved(HorizontalListBox &, const int oldIndex, const int newIndex) {
+    ListInputTrace::Event event;
+    event.type = EventType::colMoved;
+    event.oldIndex = oldIndex;
+    event.newIndex = newIndex;
+    addEvent(event);
+}
+
+void ListInputRecorder::listColChanged(HorizontalListBox &, const int col) {
+    addColsEvent(EventType::colChanged, {col, col + 1});
+}
+
+void ListInputRecorder::listColsChanged(HorizontalListBox &, const IntervalSet &cols) {
+    for (auto &r : cols)
+        addColsEvent(EventType::colsChanged, r);
+}
+
+void ListInputRecorder::addColsEvent(const ListInputTrace::Event::Type type, const Range<int> cols) {
+    ListInputTrace::Event event;
+    event.type = type;
+    event.cols = cols;
+    addEvent(event);
+}
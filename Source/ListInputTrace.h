@@ -0,0 +1,150 @@
+/*
+  ==============================================================================
+
+    ListInputTrace.h
+    Created: 18 Oct 2026 7:25:09pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBox.h"
+
+/**
+    A timestamped recording of the input a HorizontalListBox received and the changes
+    made to its content, which a ListTraceReplayer can play back.
+
+    Traces are written in a compact binary form (a few bytes per event), so they can
+    be recorded in the field and sent back with a bug report.
+    @see ListInputRecorder, ListTraceReplayer
+*/
+class ListInputTrace {
+public:
+    struct Event {
+        enum class Type : uint8 {
+            mouseDown, mouseDrag, mouseUp, mouseMove, wheel, key, resize, contentUpdated, colsRemovedFromStart,
+            colsInserted, colsRemoved, colMoved, colChanged, colsChanged, allColsChanged
+        };
+
+        Type type = Type::mouseMove;
+        double time = 0;               // milliseconds since the recording started
+        Point<int> position;           // mouse events, relative to the list
+        int mods = 0;                  // mouse and key events: the raw ModifierKeys flags
+        int numClicks = 0;             // mouseDown and mouseUp
+        MouseWheelDetails wheel{};     // wheel
+        int keyCode = 0;               // key
+        juce_wchar textCharacter = 0;  // key
+        int width = 0, height = 0;     // resize
+        int numCols = 0;               // contentUpdated and allColsChanged (the new total), colsRemovedFromStart
+        Range<int> cols;               // colsInserted, colsRemoved, colChanged and colsChanged (one event per range)
+        int oldIndex = 0, newIndex = 0;  // colMoved
+    };
+
+    //==============================================================================
+    /** Adds an event to the end. Events must be added in time order. */
+    void add(const Event &event);
+
+    /** Returns the events, in time order. */
+    const std::vector<Event> &getEvents() const noexcept { return events; }
+
+    /** Returns the time of the last event, in milliseconds. */
+    double getLengthMs() const noexcept { return events.empty() ? 0.0 : events.back().time; }
+
+    /** Removes all the events. */
+    void clear() { events.clear(); }
+
+    //==============================================================================
+    /** Writes the trace to a stream, returning false if it fails. */
+    bool writeTo(OutputStream &out) const;
+
+    /** Replaces this trace with one read from a stream, returning false (and leaving
+        this empty) if the stream doesn't hold a valid trace.
+    */
+    bool readFrom(InputStream &in);
+
+    /** Writes the trace to a file, replacing it. */
+    bool save(const File &file) const;
+
+    /** Reads a trace from a file. */
+    bool load(const File &file);
+
+    //==============================================================================
+    /** Creates a trace that drags the list's width from its widest to its narrowest
+        and back again a number of times, one step per 60Hz frame, as a window resize
+        would. The first event makes the list as wide as it gets.
+    */
+    static ListInputTrace createResizeTrace(Range<int> widths, int height, int numSweeps, int stepSize = 8);
+
+private:
+    std::vector<Event> events;
+
+    JUCE_LEAK_DETECTOR (ListInputTrace)
+};
+
+//==============================================================================
+/**
+    Records what happens to a HorizontalListBox into a ListInputTrace: the mouse,
+    wheel and key events it gets, its size, and the calls that tell it its model has
+    changed, such as updateContent(), colsInserted() and colChanged().
+
+    Recording starts when this is created and stops when it's deleted, and it only
+    adds a few bytes per event, so it can be left running in a release build.
+*/
+class ListInputRecorder : private MouseListener,
+                          private KeyListener,
+                          private ComponentListener,
+                          private HorizontalListBox::Listener {
+public:
+    explicit ListInputRecorder(HorizontalListBox &listToRecord);
+
+    ~ListInputRecorder() override;
+
+    /** Returns what's been recorded so far. */
+    const ListInputTrace &getTrace() const noexcept { return trace; }
+
+private:
+    HorizontalListBox &list;
+    ListInputTrace trace;
+    const double startTime;
+
+    void addEvent(ListInputTrace::Event &event);
+
+    void addMouseEvent(ListInputTrace::Event::Type type, const MouseEvent &e);
+
+    void mouseDown(const MouseEvent &e) override;
+
+    void mouseDrag(const MouseEvent &e) override;
+
+    void mouseUp(const MouseEvent &e) override;
+
+    void mouseMove(const MouseEvent &e) override;
+
+    void mouseWheelMove(const MouseEvent &e, const MouseWheelDetails &wheel) override;
+
+    bool keyPressed(const KeyPress &key, Component *originatingComponent) override;
+
+    void componentMovedOrResized(Component &component, bool wasMoved, bool wasResized) override;
+
+    void listContentUpdated(HorizontalListBox &, int numCols) override;
+
+    void listAllColsChanged(HorizontalListBox &, int numCols) override;
+
+    void listColsRemovedFromStart(HorizontalListBox &, int numRemoved) override;
+
+    void listColsInserted(HorizontalListBox &, int startIndex, int numInserted) override;
+
+    void listColsRemoved(HorizontalListBox &, int startIndex, int numRemoved) override;
+
+    void listColMoved(HorizontalListBox &, int oldIndex, int newIndex) override;
+
+    void listColChanged(HorizontalListBox &, int col) override;
+
+    void listColsChanged(HorizontalListBox &, const IntervalSet &cols) override;
+
+    void addColsEvent(ListInputTrace::Event::Type type, Range<int> cols);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListInputRecorder)
+};
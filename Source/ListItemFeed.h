@@ -0,0 +1,135 @@
+/*
+  ==============================================================================
+
+    ListItemFeed.h
+    Created: 18 Oct 2026 7:12:27pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBox.h"
+#include "MpscQueue.h"
+
+/**
+    Lets background threads append items to a HorizontalListBox's model.
+
+    Any thread can call add(); the items go into a lock-free queue, and once per frame
+    the message thread takes everything that's arrived and hands it to your append
+    function in one batch, then calls updateContent() on the list. So however fast
+    the items arrive, the list is only recounted and laid out once per frame.
+
+    @code
+    ListItemFeed<String> feed { list, [&](std::vector<String> &items) {
+        for (auto &s : items)
+            model.addStringItem(std::move(s));
+    }};
+
+    // on a network thread..
+    feed.add(message);
+    @endcode
+
+    The feed must outlive any threads that are adding to it.
+*/
+template <typename ItemType>
+class ListItemFeed : private AsyncUpdater,
+                     private Timer {
+public:
+    /** Called on the message thread with the items that have arrived since last time,
+        in the order they were added. It can move them out of the vector.
+    */
+    using AppendFunction = std::function<void(std::vector<ItemType> &)>;
+
+    ListItemFeed(HorizontalListBox &listToUpdate, AppendFunction appendItemsToModel, int queueCapacity = 65536)
+            : list(&listToUpdate), appendItems(std::move(appendItemsToModel)), queue(queueCapacity) {}
+
+    ~ListItemFeed() override {
+        stopTimer();
+        cancelPendingUpdate();
+    }
+
+    //==============================================================================
+    /** Queues an item to be appended. This can be called from any thread.
+
+        Returns false if the queue is full, which only happens if items are being
+        added faster than the message thread can take them, or it's blocked. It's
+        up to you whether to retry, wait, or drop the item.
+    */
+    bool add(ItemType item) {
+        if (!queue.push(std::move(item)))
+            return false;
+
+        // only the first item since the last drain needs to wake the message thread
+        if (!drainScheduled.exchange(true))
+            triggerAsyncUpdate();
+
+        return true;
+    }
+
+    /** Appends anything that's waiting straight away, rather than at the next frame.
+        This must be called on the message thread.
+    */
+    void flush() {
+        stopTimer();
+        drain();
+    }
+
+    /** Returns the number of items the queue can hold. */
+    int getCapacity() const noexcept { return queue.getCapacity(); }
+
+private:
+    //==============================================================================
+    void handleAsyncUpdate() override {
+        const auto sinceLastDrain = Time::getMillisecondCounterHiRes() - lastDrainTime;
+
+        if (sinceLastDrain >= frameIntervalMs)
+            drain();
+        else if (!isTimerRunning())
+            startTimer(jmax(1, roundToInt(frameIntervalMs - sinceLastDrain)));
+    }
+
+    void timerCallback() override {
+        stopTimer();
+        drain();
+    }
+
+    void drain() {
+        // cleared before popping, so that anything pushed after we've looked schedules another drain
+        drainScheduled = false;
+        lastDrainTime = Time::getMillisecondCounterHiRes();
+
+        batch.clear();
+        ItemType item;
+
+        // take at most one queue's worth, so that producers that keep up with us can't
+        // keep the message thread in here forever
+        const auto maxItems = (size_t) queue.getCapacity();
+
+        while (batch.size() < maxItems && queue.pop(item))
+            batch.push_back(std::move(item));
+
+        if (batch.size() == maxItems && !drainScheduled.exchange(true))
+            startTimer(roundToInt(frameIntervalMs));
+
+        if (!batch.empty()) {
+            appendItems(batch);
+
+            if (list != nullptr)
+                list->updateContent();
+        }
+    }
+
+    static constexpr double frameIntervalMs = 1000.0 / 60.0;
+
+    Component::SafePointer<HorizontalListBox> list;
+    AppendFunction appendItems;
+    MpscQueue<ItemType> queue;
+    std::atomic<bool> drainScheduled{false};
+    std::vector<ItemType> batch;
+    double lastDrainTime = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListItemFeed)
+};
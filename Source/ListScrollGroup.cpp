@@ -0,0 +1,110 @@
+/*
+  ==============================================================================
+
+    ListScrollGroup.cpp
+    Created: 18 Oct 2026 7:31:52pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ListScrollGroup.h"
+
+ListScrollGroup::ListScrollGroup() {}
+
+ListScrollGroup::~ListScrollGroup() {
+    while (!lists.isEmpty())
+        removeList(*lists.getLast());
+}
+
+//==============================================================================
+void ListScrollGroup::addList(HorizontalListBox &list, const bool shareRenderCache) {
+    if (lists.contains(&list))
+        return;
+
+    if (lists.isEmpty() && !isAnimating)
+        position = list.getScrollPositionX();
+
+    lists.add(&list);
+    list.addListener(this);
+
+    if (shareRenderCache)
+        list.setRenderCache(&renderCache);
+
+    const ScopedValueSetter<bool> svs(isMovingLists, true);
+    list.setScrollPositionX(position);
+}
+
+void ListScrollGroup::removeList(HorizontalListBox &list) {
+    if (!lists.contains(&list))
+        return;
+
+    list.removeListener(this);
+    lists.removeFirstMatchingValue(&list);
+
+    if (list.getRenderCache() == &renderCache)
+        list.setRenderCache(nullptr);
+
+    if (scrolledList == &list)
+        scrolledList = nullptr;
+}
+
+//==============================================================================
+void ListScrollGroup::setScrollPositionX(const double newX, const bool animate, const int animationMs) {
+    cancelPendingUpdate();
+    scrolledList = nullptr;
+
+    if (animate) {
+        animationStartX = position;
+        animationTargetX = newX;
+        animationStartTime = Time::getMillisecondCounterHiRes();
+        animationDurationMs = jmax(1, animationMs);
+        isAnimating = true;
+        startTimerHz(60);
+    } else {
+        isAnimating = false;
+        stopTimer();
+        position = newX;
+        moveLists();
+    }
+}
+
+void ListScrollGroup::listWasScrolled(HorizontalListBox &list) {
+    if (isMovingLists)
+        return;
+
+    // the user has taken over from the group
+    isAnimating = false;
+    stopTimer();
+
+    position = list.getScrollPositionX();
+    scrolledList = &list;
+    triggerAsyncUpdate();
+}
+
+void ListScrollGroup::handleAsyncUpdate() {
+    moveLists();
+    scrolledList = nullptr;
+}
+
+void ListScrollGroup::timerCallback() {
+    const auto progress = jmin(1.0, (Time::getMillisecondCounterHiRes() - animationStartTime) / animationDurationMs);
+
+    // eases out in the same way as the lists' own animations
+    position = animationStartX + (animationTargetX - animationStartX) * (1.0 - std::pow(1.0 - progress, 3.0));
+
+    if (progress >= 1.0) {
+        isAnimating = false;
+        stopTimer();
+    }
+
+    moveLists();
+}
+
+void ListScrollGroup::moveLists() {
+    const ScopedValueSetter<bool> svs(isMovingLists, true);
+
+    for (auto *list : lists)
+        if (list != scrolledList && list->getScrollPositionX() != position)
+            list->setScrollPositionX(position);
+}
@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    ListScrollGroup.h
+    Created: 18 Oct 2026 7:31:52pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBox.h"
+#include "ItemRenderCache.h"
+
+/**
+    Keeps several HorizontalListBoxes scrolled to the same position, e.g. parallel
+    tracks in a timeline.
+
+    The group holds the position, in pixels, and moves all the lists to it. When one
+    of them is scrolled by the user, the group takes that list's position and moves
+    the others there once the message loop is free, so that however many scroll events
+    arrive, each list is only laid out once. Lists that the group is moving don't report
+    back to it, so there's no feedback between them. Animated scrolls are run on one
+    clock for the whole group.
+
+    Lists that show the same model can also share the group's ItemRenderCache, so that
+    each item is only painted once whichever track it's in.
+
+    Lists have to be removed from the group before they're deleted.
+*/
+class ListScrollGroup : private HorizontalListBox::Listener,
+                        private AsyncUpdater,
+                        private Timer {
+public:
+    ListScrollGroup();
+
+    ~ListScrollGroup() override;
+
+    //==============================================================================
+    /** Adds a list to the group and scrolls it to the group's position. The first list
+        added sets the position instead.
+
+        If shareRenderCache is true, the list uses the group's render cache.
+    */
+    void addList(HorizontalListBox &list, bool shareRenderCache = false);
+
+    /** Removes a list from the group, and stops it using the group's render cache. */
+    void removeList(HorizontalListBox &list);
+
+    /** Returns the number of lists in the group. */
+    int getNumLists() const noexcept { return lists.size(); }
+
+    //==============================================================================
+    /** Scrolls all the lists to a position, in pixels.
+
+        If animate is true, they glide there together over the given number of
+        milliseconds. Scrolling any of the lists stops the animation.
+    */
+    void setScrollPositionX(double newX, bool animate = false, int animationMs = 250);
+
+    /** Returns the position the group is scrolled to, or is animating towards. */
+    double getScrollPositionX() const noexcept { return isAnimating ? animationTargetX : position; }
+
+    //==============================================================================
+    /** Returns the cache used by lists that were added with shareRenderCache. */
+    ItemRenderCache &getRenderCache() noexcept { return renderCache; }
+
+private:
+    //==============================================================================
+    Array<HorizontalListBox *> lists;
+    ItemRenderCache renderCache;
+    HorizontalListBox *scrolledList = nullptr;
+    double position = 0, animationStartX = 0, animationTargetX = 0, animationStartTime = 0;
+    int animationDurationMs = 0;
+    bool isMovingLists = false, isAnimating = false;
+
+    void listWasScrolled(HorizontalListBox &list) override;
+
+    void handleAsyncUpdate() override;
+
+    void timerCallback() override;
+
+    void moveLists();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListScrollGroup)
+};
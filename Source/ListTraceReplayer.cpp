@@ -0,0 +1,305 @@
+/*
+  ==============================================================================
+
+    ListTraceReplayer.cpp
+    Created: 18 Oct 2026 7:25:09pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ListTraceReplayer.h"
+
+namespace {
+    const double frameBudgetMs = 1000.0 / 60.0;
+}
+
+using EventType = ListInputTrace::Event::Type;
+
+//==============================================================================
+String ListTraceReplayer::Results::toString() const {
+    return "frames: " + String(numFrames)
+           + ", p50: " + String(p50, 2) + "ms"
+           + ", p90: " + String(p90, 2) + "ms"
+           + ", p99: " + String(p99, 2) + "ms"
+           + ", max: " + String(maxMs, 2) + "ms"
+           + ", mean: " + String(meanMs, 2) + "ms"
+           + ", over " + String(frameBudgetMs, 1) + "ms: " + String(numSlowFrames)
+           + (numRepeatedResizes > 0 ? ", repeated resizes: " + String(numRepeatedResizes)
+                                       + (AllocationCounter::isEnabled()
+                                          ? ", allocations in them: " + String(numRepeatedResizeAllocations)
+                                          : String(" (allocation counting disabled)"))
+                                     : String());
+}
+
+//==============================================================================
+ListTraceReplayer::ListTraceReplayer(HorizontalListBox &listToDrive, const ListInputTrace &traceToPlay)
+        : list(listToDrive), trace(traceToPlay) {}
+
+ListTraceReplayer::~ListTraceReplayer() {
+    stopTimer();
+}
+
+void ListTraceReplayer::start(const double speed) {
+    playbackSpeed = jmax(0.0, speed);
+    traceTime = 0;
+    nextEvent = 0;
+    frameTimes.clear();
+    largestSize = {};
+    numRepeatedResizes = 0;
+    numRepeatedResizeAllocations = 0;
+    mouseDownTarget = nullptr;
+    mouseOverTarget = nullptr;
+    lastFrameTime = Time::getMillisecondCounterHiRes();
+
+    if (playbackSpeed > 0)
+        startTimerHz(60);
+    else
+        startTimer(1);
+}
+
+void ListTraceReplayer::stop() {
+    stopTimer();
+}
+
+void ListTraceReplayer::addMouseListener(MouseListener *const listener) {
+    mouseListeners.addIfNotAlreadyThere(listener);
+}
+
+void ListTraceReplayer::removeMouseListener(MouseListener *const listener) {
+    mouseListeners.removeFirstMatchingValue(listener);
+}
+
+ListTraceReplayer::Results ListTraceReplayer::getResults() const {
+    Results r;
+    r.numFrames = (int) frameTimes.size();
+    r.numRepeatedResizes = numRepeatedResizes;
+    r.numRepeatedResizeAllocations = numRepeatedResizeAllocations;
+
+    if (frameTimes.empty())
+        return r;
+
+    auto sorted = frameTimes;
+    std::sort(sorted.begin(), sorted.end());
+
+    // nearest-rank percentiles, so each one is a frame time that actually happened
+    auto percentile = [&sorted](const double p) {
+        const auto rank = (size_t) std::ceil(p * sorted.size());
+        return sorted[jlimit((size_t) 0, sorted.size() - 1, rank - 1)];
+    };
+
+    r.p50 = percentile(0.5);
+    r.p90 = percentile(0.9);
+    r.p99 = percentile(0.99);
+    r.maxMs = sorted.back();
+    r.meanMs = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    r.numSlowFrames = (int) (sorted.end() - std::upper_bound(sorted.begin(), sorted.end(), frameBudgetMs));
+
+    return r;
+}
+
+//==============================================================================
+void ListTraceReplayer::timerCallback() {
+    const auto now = Time::getMillisecondCounterHiRes();
+    traceTime += playbackSpeed > 0 ? (now - lastFrameTime) * playbackSpeed : frameBudgetMs;
+    lastFrameTime = now;
+
+    const auto &events = trace.getEvents();
+    const auto frameStart = Time::getMillisecondCounterHiRes();
+
+    while (nextEvent < events.size() && events[nextEvent].time <= traceTime)
+        playEvent(events[nextEvent++]);
+
+    renderFrame();
+    frameTimes.push_back(Time::getMillisecondCounterHiRes() - frameStart);
+
+    if (nextEvent >= events.size()) {
+        stopTimer();
+
+        // this may delete us, so it has to be the last thing we do
+        if (onFinished != nullptr)
+            onFinished(getResults());
+    }
+}
+
+// Like JUCE's own dispatch, this stops if the target is deleted by one of the callbacks.
+template <typename Callback>
+void ListTraceReplayer::sendMouseEvent(Component &target, const ListInputTrace::Event &e, Callback &&callback) {
+    const auto me = createMouseEvent(target, e);
+    const Component::SafePointer<Component> safeTarget(&target);
+    callback(target, me);
+
+    // the list's own listeners are added with wantsEventsForAllNestedChildComponents set,
+    // so they hear about events for any of its components
+    if (safeTarget != nullptr && list.mouseMoveSelector != nullptr)
+        callback(*list.mouseMoveSelector, me);
+
+    for (int i = mouseListeners.size(); --i >= 0 && safeTarget != nullptr;) {
+        callback(*mouseListeners.getUnchecked(i), me);
+        i = jmin(i, mouseListeners.size());
+    }
+}
+
+void ListTraceReplayer::moveMouseOver(Component &target, const ListInputTrace::Event &e) {
+    if (mouseOverTarget == &target)
+        return;
+
+    if (auto *old = mouseOverTarget.getComponent())
+        sendMouseEvent(*old, e, [](MouseListener &l, const MouseEvent &me) { l.mouseExit(me); });
+
+    mouseOverTarget = &target;
+    sendMouseEvent(target, e, [](MouseListener &l, const MouseEvent &me) { l.mouseEnter(me); });
+}
+
+// The list isn't on the desktop, so there's no peer to send mouse events through. They're
+// sent to the component under the pointer and then to the mouse listeners, in the order
+// JUCE would use, with enter and exit events when the pointer moves between components.
+void ListTraceReplayer::playEvent(const ListInputTrace::Event &e) {
+    auto targetAt = [this](const Point<int> position) -> Component & {
+        if (auto *c = list.getComponentAt(position))
+            return *c;
+
+        return list;
+    };
+
+    switch (e.type) {
+        case EventType::mouseDown:
+            mouseDownTarget = &targetAt(e.position);
+            mouseDownPosition = e.position.toFloat();
+            mouseDownTime = Time::getCurrentTime();
+            mouseWasDragged = false;
+            moveMouseOver(*mouseDownTarget, e);
+
+            if (auto *target = mouseDownTarget.getComponent())
+                sendMouseEvent(*target, e, [](MouseListener &l, const MouseEvent &me) { l.mouseDown(me); });
+            break;
+
+        case EventType::mouseDrag:
+            if (auto *target = mouseDownTarget.getComponent()) {
+                mouseWasDragged = true;
+                sendMouseEvent(*target, e, [](MouseListener &l, const MouseEvent &me) { l.mouseDrag(me); });
+            }
+            break;
+
+        case EventType::mouseUp:
+            if (auto *target = mouseDownTarget.getComponent())
+                sendMouseEvent(*target, e, [](MouseListener &l, const MouseEvent &me) { l.mouseUp(me); });
+
+            mouseDownTarget = nullptr;
+            break;
+
+        case EventType::mouseMove:
+            moveMouseOver(targetAt(e.position), e);
+
+            if (auto *target = mouseOverTarget.getComponent())
+                sendMouseEvent(*target, e, [](MouseListener &l, const MouseEvent &me) { l.mouseMove(me); });
+            break;
+
+        case EventType::wheel: {
+            auto &target = targetAt(e.position);
+            sendMouseEvent(target, e, [&e](MouseListener &l, const MouseEvent &me) { l.mouseWheelMove(me, e.wheel); });
+            break;
+        }
+
+        case EventType::key:
+            list.keyPressed(KeyPress(e.keyCode, ModifierKeys(e.mods), e.textCharacter));
+            break;
+
+        case EventType::resize:
+            resize(e.width, e.height);
+            break;
+
+        case EventType::contentUpdated:
+            if (onContentUpdated != nullptr)
+                onContentUpdated(e.numCols);
+            else
+                list.updateContent();
+            break;
+
+        case EventType::colsRemovedFromStart:
+            if (onColsRemovedFromStart != nullptr)
+                onColsRemovedFromStart(e.numCols);
+            else
+                list.colsRemovedFromStart(e.numCols);
+            break;
+
+        case EventType::allColsChanged:
+            if (onAllColsChanged != nullptr)
+                onAllColsChanged(e.numCols);
+            else
+                list.allColsChanged();
+            break;
+
+        case EventType::colsInserted:
+            if (onColsInserted != nullptr)
+                onColsInserted(e.cols.getStart(), e.cols.getLength());
+            else
+                list.colsInserted(e.cols.getStart(), e.cols.getLength());
+            break;
+
+        case EventType::colsRemoved:
+            if (onColsRemoved != nullptr)
+                onColsRemoved(e.cols.getStart(), e.cols.getLength());
+            else
+                list.colsRemoved(e.cols.getStart(), e.cols.getLength());
+            break;
+
+        case EventType::colMoved:
+            if (onColMoved != nullptr)
+                onColMoved(e.oldIndex, e.newIndex);
+            else
+                list.colMoved(e.oldIndex, e.newIndex);
+            break;
+
+        case EventType::colChanged:
+            if (onColChanged != nullptr)
+                onColChanged(e.cols.getStart());
+            else
+                list.colChanged(e.cols.getStart());
+            break;
+
+        case EventType::colsChanged:
+            if (onColsChanged != nullptr)
+                onColsChanged(e.cols);
+            else
+                list.colsChanged(IntervalSet(e.cols));
+            break;
+    }
+}
+
+void ListTraceReplayer::resize(const int width, const int height) {
+    const auto isRepeat = largestSize.contains(Rectangle<int>(width, height));
+    largestSize = largestSize.getUnion({width, height});
+
+    AllocationCounter counter;
+    list.setSize(width, height);
+
+    if (isRepeat) {
+        ++numRepeatedResizes;
+        numRepeatedResizeAllocations += counter.getNumAllocations();
+    }
+}
+
+void ListTraceReplayer::renderFrame() {
+    const auto w = list.getWidth(), h = list.getHeight();
+
+    if (w <= 0 || h <= 0)
+        return;
+
+    if (frame.getWidth() != w || frame.getHeight() != h)
+        frame = Image(Image::ARGB, w, h, true);
+
+    Graphics g(frame);
+    list.paintEntireComponent(g, true);
+}
+
+MouseEvent ListTraceReplayer::createMouseEvent(Component &target, const ListInputTrace::Event &e) const {
+    return MouseEvent(Desktop::getInstance().getMainMouseSource(),
+                      target.getLocalPoint(&list, e.position.toFloat()), ModifierKeys(e.mods),
+                      MouseInputSource::invalidPressure, MouseInputSource::invalidOrientation,
+                      MouseInputSource::invalidRotation, MouseInputSource::invalidTiltX,
+                      MouseInputSource::invalidTiltY,
+                      &target, &target, Time::getCurrentTime(),
+                      target.getLocalPoint(&list, mouseDownPosition), mouseDownTime,
+                      jmax(1, e.numClicks), mouseWasDragged);
+}
@@ -0,0 +1,170 @@
+/*
+  ==============================================================================
+
+    ListTraceReplayer.h
+    Created: 18 Oct 2026 7:25:09pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBox.h"
+#include "ListInputTrace.h"
+#include "AllocationCounter.h"
+
+/**
+    Plays a ListInputTrace back into a HorizontalListBox, rendering a frame after each
+    step and timing it, so that a trace from a slow machine can be turned into a
+    repeatable performance test.
+
+    The list doesn't need to be on the screen: each frame is rendered into an image
+    with paintEntireComponent(), and the time for a frame includes handling its events
+    as well as painting. Replays can run at the recorded speed, faster, or as fast as
+    possible. The events are always delivered in the same order, but the list's own
+    animations run on real time, so a faster replay sees fewer of their frames.
+
+    Resize events are checked for memory allocations. A resize to a size that's bigger
+    than any the list has been before may need to create new columns, but once it's
+    been as big, resizing it within that size should reuse them and not allocate
+    anything, so the allocations made by those resizes are counted in the results.
+    The count includes anything the model allocates while the list is resized, and is
+    only made in builds where AllocationCounter::isEnabled() is true.
+
+    Mouse events go to the component under the recorded position, and then to the
+    list's own mouse listeners, such as the one that selects columns as the mouse
+    moves over them. JUCE can't say which other mouse listeners a component has, so
+    any that the app has added and that should see the events have to be passed to
+    addMouseListener().
+
+    The list's model should start out the same as it was when the trace was recorded,
+    and the changes that were made to it have to be made again by the app. Set the
+    callbacks for the content events, like onContentUpdated and onColsInserted, to do
+    that; if one isn't set, the list is just told about the change, as if the model
+    had already been changed.
+
+    This must only be used on the message thread.
+*/
+class ListTraceReplayer : private Timer {
+public:
+    struct Results {
+        int numFrames = 0;
+        int numSlowFrames = 0;  // frames that took longer than the 60Hz frame budget
+        double p50 = 0, p90 = 0, p99 = 0, maxMs = 0, meanMs = 0;
+        int numRepeatedResizes = 0;              // resizes that didn't make the list bigger than it had been
+        int64 numRepeatedResizeAllocations = 0;  // the allocations those resizes made
+
+        String toString() const;
+    };
+
+    ListTraceReplayer(HorizontalListBox &listToDrive, const ListInputTrace &traceToPlay);
+
+    ~ListTraceReplayer() override;
+
+    //==============================================================================
+    /** Called for each contentUpdated event, with the number of columns the list had.
+        It should make the model that size and call updateContent().
+    */
+    std::function<void(int numCols)> onContentUpdated;
+
+    /** Called for each colsRemovedFromStart event. It should remove the columns from
+        the model and call colsRemovedFromStart().
+    */
+    std::function<void(int numRemoved)> onColsRemovedFromStart;
+
+    /** Called for each allColsChanged event, with the number of columns the list had.
+        It should change the model's items and call allColsChanged().
+    */
+    std::function<void(int numCols)> onAllColsChanged;
+
+    /** Called for each colsInserted event. It should insert the columns into the model
+        and call colsInserted().
+    */
+    std::function<void(int startIndex, int numInserted)> onColsInserted;
+
+    /** Called for each colsRemoved event. It should remove the columns from the model
+        and call colsRemoved().
+    */
+    std::function<void(int startIndex, int numRemoved)> onColsRemoved;
+
+    /** Called for each colMoved event. It should move the item in the model and call
+        colMoved().
+    */
+    std::function<void(int oldIndex, int newIndex)> onColMoved;
+
+    /** Called for each colChanged event. It should change the item in the model and
+        call colChanged().
+    */
+    std::function<void(int col)> onColChanged;
+
+    /** Called for each colsChanged event, which covers one range of the columns that
+        were passed to colsChanged(). It should change the items in the model and call
+        colsChanged().
+    */
+    std::function<void(Range<int> cols)> onColsChanged;
+
+    /** Called when the replay has finished. */
+    std::function<void(const Results &)> onFinished;
+
+    //==============================================================================
+    /** Adds a listener to be sent the replayed mouse events, as if it had been added
+        to the list with Component::addMouseListener(listener, true).
+    */
+    void addMouseListener(MouseListener *listener);
+
+    /** Removes a listener that was added with addMouseListener(). */
+    void removeMouseListener(MouseListener *listener);
+
+    //==============================================================================
+    /** Starts playing the trace from the beginning. A speed of 1 plays it at the
+        recorded speed and 2 plays it twice as fast; 0 plays it as fast as possible,
+        moving on by one 60Hz frame of trace time for each frame rendered.
+    */
+    void start(double speed = 1.0);
+
+    /** Stops the replay without calling onFinished. */
+    void stop();
+
+    /** Returns true while the replay is running. */
+    bool isReplaying() const noexcept { return isTimerRunning(); }
+
+    /** Returns the results for the frames played so far. */
+    Results getResults() const;
+
+private:
+    //==============================================================================
+    HorizontalListBox &list;
+    const ListInputTrace &trace;
+    double playbackSpeed = 1.0, traceTime = 0, lastFrameTime = 0;
+    size_t nextEvent = 0;
+    std::vector<double> frameTimes;
+    Image frame;
+    Rectangle<int> largestSize;
+    int numRepeatedResizes = 0;
+    int64 numRepeatedResizeAllocations = 0;
+
+    Array<MouseListener *> mouseListeners;
+    Component::SafePointer<Component> mouseDownTarget, mouseOverTarget;
+    Point<float> mouseDownPosition;
+    Time mouseDownTime;
+    bool mouseWasDragged = false;
+
+    void timerCallback() override;
+
+    void playEvent(const ListInputTrace::Event &e);
+
+    void resize(int width, int height);
+
+    void renderFrame();
+
+    MouseEvent createMouseEvent(Component &target, const ListInputTrace::Event &e) const;
+
+    template <typename Callback>
+    void sendMouseEvent(Component &target, const ListInputTrace::Event &e, Callback &&callback);
+
+    void moveMouseOver(Component &target, const ListInputTrace::Event &e);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListTraceReplayer)
+};
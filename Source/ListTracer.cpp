@@ -0,0 +1,113 @@
+/*
+  ==============================================================================
+
+    ListTracer.cpp
+    Created: 18 Oct 2026 7:26:21pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ListTracer.h"
+
+ListTracer::ListTracer(const int maxNumEvents)
+        : events(maxNumEvents), creationTime(getTime()) {}
+
+ListTracer::~ListTracer() {}
+
+//==============================================================================
+void ListTracer::addScope(const char *name, const double startTime, const int col) {
+    Event e;
+    e.name = name;
+    e.start = startTime;
+    e.duration = jmax(0.0, getTime() - startTime);
+    e.col = col;
+    add(e);
+}
+
+void ListTracer::addInstant(const char *name, const int col) {
+    Event e;
+    e.name = name;
+    e.start = getTime();
+    e.col = col;
+    add(e);
+}
+
+void ListTracer::add(const Event &event) {
+    auto e = event;
+    e.threadId = (uint64) (pointer_sized_uint) Thread::getCurrentThreadId();
+
+    const SpinLock::ScopedLockType sl(lock);
+    events.add(e);
+}
+
+int ListTracer::getNumEvents() const {
+    const SpinLock::ScopedLockType sl(lock);
+    return events.size();
+}
+
+void ListTracer::clear() {
+    const SpinLock::ScopedLockType sl(lock);
+    events.clear();
+}
+
+//==============================================================================
+bool ListTracer::writeChromeTrace(OutputStream &out) const {
+    std::vector<Event> copy;
+
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        copy.reserve((size_t) events.size());
+
+        for (int i = 0; i < events.size(); ++i)
+            copy.push_back(events.getReference(i));
+    }
+
+    // thread IDs are pointers on some platforms, which are too big for the viewers,
+    // so they're numbered in the order they first appear instead
+    std::map<uint64, int> threadNumbers;
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    for (size_t i = 0; i < copy.size(); ++i) {
+        const auto &e = copy[i];
+        const auto tid = threadNumbers.emplace(e.threadId, (int) threadNumbers.size() + 1).first->second;
+
+        out << (i > 0 ? ",\n" : "\n")
+            << "{\"name\":\"" << e.name << "\",\"cat\":\"HorizontalListBox\""
+            << ",\"ts\":" << String(e.start - creationTime, 3);
+
+        if (e.duration >= 0)
+            out << ",\"ph\":\"X\",\"dur\":" << String(e.duration, 3);
+        else
+            out << ",\"ph\":\"i\",\"s\":\"t\"";
+
+        out << ",\"pid\":1,\"tid\":" << tid;
+
+        if (e.col >= 0)
+            out << ",\"args\":{\"col\":" << e.col << "}";
+
+        out << "}";
+    }
+
+    out << "\n]}\n";
+    return out.getStatus().wasOk();
+}
+
+bool ListTracer::saveChromeTrace(const File &file) const {
+    TemporaryFile temp(file);
+
+    {
+        FileOutputStream out(temp.getFile());
+
+        if (out.failedToOpen() || !writeChromeTrace(out))
+            return false;
+
+        out.flush();
+
+        if (out.getStatus().failed())
+            return false;
+    }
+
+    return temp.overwriteTargetFileWithTemporary();
+}
@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    ListTracer.h
+    Created: 18 Oct 2026 7:26:21pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "RingBuffer.h"
+
+/** Set this to 0 to compile all the trace scopes out of the list. */
+#ifndef HORIZONTAL_LIST_TRACING
+ #define HORIZONTAL_LIST_TRACING 1
+#endif
+
+/**
+    Collects timed events from one or more HorizontalListBoxes and their models, and
+    exports them as Chrome trace JSON. Load the JSON in chrome://tracing or
+    ui.perfetto.dev to see where a slow frame went.
+
+    Give it to a list with HorizontalListBox::setTracer(). The newest events are kept
+    in a ring buffer, so it can be left running and saved once something goes wrong.
+    A list without a tracer only pays for one test on entering each traced scope and
+    one on leaving it. The calls into the model are traced by the same object that
+    times them for ModelCallStats, so they share those two tests. Building with
+    HORIZONTAL_LIST_TRACING=0 removes the scopes completely.
+
+    Events can be added from any thread. Event names aren't copied, so they have to
+    be string literals.
+
+    @code
+    void MyModel::paintListBoxItem(int row, Graphics &g, int w, int h, bool selected) {
+        HORIZONTAL_LIST_TRACE_SCOPE(listBox.getTracer(), "MyModel::drawWaveform", row);
+        ...
+    }
+    @endcode
+*/
+class ListTracer {
+public:
+    /** Creates a tracer that keeps up to this many of the newest events. */
+    explicit ListTracer(int maxNumEvents = 65536);
+
+    ~ListTracer();
+
+    //==============================================================================
+    /** Adds an event that started at startTime (from getTime()) and has just ended.
+        The column can be -1 if it isn't about a column.
+    */
+    void addScope(const char *name, double startTime, int col = -1);
+
+    /** Adds an event that happened at a single moment. */
+    void addInstant(const char *name, int col = -1);
+
+    /** Returns the current time in microseconds, on the clock the events use. */
+    static double getTime() noexcept { return Time::getMillisecondCounterHiRes() * 1000.0; }
+
+    /** Returns the number of events held. */
+    int getNumEvents() const;
+
+    /** Removes all the events. */
+    void clear();
+
+    //==============================================================================
+    /** Writes the events as Chrome trace JSON. */
+    bool writeChromeTrace(OutputStream &out) const;
+
+    /** Writes the events to a Chrome trace JSON file, replacing it. */
+    bool saveChromeTrace(const File &file) const;
+
+    //==============================================================================
+    /** Adds an event for the lifetime of the scope it's declared in, if the tracer
+        isn't null. Use HORIZONTAL_LIST_TRACE_SCOPE rather than this, so that it can
+        be compiled out.
+    */
+    class Scope {
+    public:
+        Scope(ListTracer *t, const char *eventName, const int eventCol) noexcept
+                : tracer(t), name(eventName), col(eventCol) {
+            if (tracer != nullptr)
+                startTime = getTime();
+        }
+
+        ~Scope() {
+            if (tracer != nullptr)
+                tracer->addScope(name, startTime, col);
+        }
+
+    private:
+        ListTracer *const tracer;
+        const char *const name;
+        const int col;
+        double startTime = 0;
+
+        JUCE_DECLARE_NON_COPYABLE (Scope)
+    };
+
+private:
+    //==============================================================================
+    struct Event {
+        const char *name = nullptr;
+        double start = 0, duration = -1; // a negative duration marks an instant
+        uint64 threadId = 0;
+        int col = -1;
+    };
+
+    mutable SpinLock lock;
+    RingBuffer<Event> events;
+    const double creationTime;
+
+    void add(const Event &event);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListTracer)
+};
+
+#if HORIZONTAL_LIST_TRACING
+ /** Traces the rest of the enclosing scope, if the tracer isn't null. */
+ #define HORIZONTAL_LIST_TRACE_SCOPE(tracer, name, col) \
+    const ListTracer::Scope JUCE_JOIN_MACRO(listTraceScope_, __LINE__)(tracer, name, col)
+
+ /** Adds an instant event, if the tracer isn't null. */
+ #define HORIZONTAL_LIST_TRACE_INSTANT(tracer, name, col) \
+    do { if (auto *listTracer_ = (tracer)) listTracer_->addInstant(name, col); } while (false)
+#else
+ #define HORIZONTAL_LIST_TRACE_SCOPE(tracer, name, col)
+ #define HORIZONTAL_LIST_TRACE_INSTANT(tracer, name, col) do {} while (false)
+#endif
@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    ListWorkerPool.h
+    Created: 18 Oct 2026 6:58:48pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+    The thread pool that HorizontalListBox and its models share for background work.
+
+    Don't create one of these directly - hold a SharedResourcePointer<ListWorkerPool>,
+    so that every list and model in the app ends up using the same set of threads.
+*/
+class ListWorkerPool : public ThreadPool {
+public:
+    ListWorkerPool() : ThreadPool(jmax(1, SystemStats::getNumCpus() - 1)) {}
+
+    /** Splits the range [0, numItems) into chunks and calls the function for each one.
+
+        The chunks are shared out between the pool's threads and the calling thread, and
+        this blocks until they've all been processed. Each chunk is only processed once, but
+        the order in which they run isn't defined, so the function must be safe to call
+        from several threads at once.
+
+        If everything fits into a single chunk, it's just called directly on this thread.
+
+        Keep the SharedResourcePointer you call this through alive between calls, e.g. as a
+        member, because if it's the only one, the pool and all its threads are created and
+        destroyed along with it.
+    */
+    void parallelFor(int numItems, int chunkSize, const std::function<void(Range<int>)> &function) {
+        if (numItems <= 0)
+            return;
+
+        chunkSize = jmax(1, chunkSize);
+        const auto numChunks = (int) (((int64) numItems + chunkSize - 1) / chunkSize);
+
+        if (numChunks == 1) {
+            function({0, numItems});
+            return;
+        }
+
+        // The pool's threads may not get round to their job until after we've returned, so
+        // the state they share with us is reference-counted. They only call the function for
+        // chunks they've claimed, and we don't return until every claimed chunk is done.
+        auto state = std::make_shared<ParallelForState>(function, numItems, chunkSize, numChunks);
+
+        for (int i = jmin(getNumThreads(), numChunks - 1); --i >= 0;)
+            addJob([state] { while (state->processNextChunk()) {} });
+
+        while (state->processNextChunk()) {}
+
+        state->finished.wait();
+    }
+
+    /** Returns a chunk size that splits a job of the given size into a few chunks per
+        thread, but never makes the chunks smaller than minimumChunkSize.
+    */
+    static int getDefaultChunkSize(int numItems, int minimumChunkSize = 4096) {
+        return jmax(minimumChunkSize, numItems / (jmax(1, SystemStats::getNumCpus()) * 8));
+    }
+
+private:
+    struct ParallelForState {
+        ParallelForState(const std::function<void(Range<int>)> &f, int total, int size, int chunks)
+                : function(f), numItems(total), chunkSize(size), numChunks(chunks) {}
+
+        bool processNextChunk() {
+            const auto chunk = nextChunk++;
+
+            if (chunk >= numChunks)
+                return false;
+
+            const auto start = chunk * chunkSize;
+            function({start, (int) jmin((int64) numItems, (int64) start + chunkSize)});
+
+            if (++chunksDone == numChunks)
+                finished.signal();
+
+            return true;
+        }
+
+        const std::function<void(Range<int>)> &function;
+        const int numItems, chunkSize, numChunks;
+        std::atomic<int> nextChunk{0}, chunksDone{0};
+        WaitableEvent finished;
+    };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ListWorkerPool)
+};
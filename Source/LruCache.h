@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    LruCache.h
+    Created: 18 Oct 2026 8:14:40pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+    A map that holds values up to a budget of bytes, dropping the least recently used
+    ones when it goes over.
+
+    SizeFunction is a function object that returns the number of bytes a value uses,
+    and HashFunction one that hashes a key. Values are returned by copy, so they should
+    be cheap to copy, e.g. a shared_ptr or a reference-counted Image.
+
+    The newest value is always kept, even if it's bigger than the whole budget, so
+    something that's just been added can always be found straight away.
+
+    Like Array, this takes a TypeOfCriticalSectionToUse: leave it as the default
+    DummyCriticalSection if the cache is only used on one thread, or use a
+    CriticalSection if it's shared between threads.
+*/
+template <typename KeyType, typename ValueType, typename SizeFunction,
+          typename HashFunction = std::hash<KeyType>,
+          typename TypeOfCriticalSectionToUse = DummyCriticalSection>
+class LruCache {
+public:
+    /** Creates a cache that holds up to this many bytes of values. */
+    explicit LruCache(int64 maxBytesToUse) : maxBytes(jmax((int64) 0, maxBytesToUse)) {}
+
+    //==============================================================================
+    /** Returns the value for a key, or a default-constructed value if it's not there.
+        A value that's found becomes the most recently used one.
+    */
+    ValueType find(const KeyType &key) {
+        const ScopedLockType sl(lock);
+        auto found = index.find(key);
+
+        if (found == index.end())
+            return {};
+
+        entries.splice(entries.begin(), entries, found->second);
+        return found->second->value;
+    }
+
+    /** Adds a value, replacing any that's already there for the same key, and then drops
+        the least recently used values until the cache is back within its budget.
+    */
+    void add(const KeyType &key, ValueType value) {
+        const ScopedLockType sl(lock);
+        auto found = index.find(key);
+
+        if (found != index.end()) {
+            numBytes -= sizeOf(found->second->value);
+            entries.erase(found->second);
+            index.erase(found);
+        }
+
+        numBytes += sizeOf(value);
+        entries.push_front({key, std::move(value)});
+        index[key] = entries.begin();
+        trim();
+    }
+
+    /** Removes the values whose keys a predicate returns true for. */
+    template <typename Predicate>
+    void removeIf(Predicate &&shouldRemove) {
+        const ScopedLockType sl(lock);
+
+        for (auto i = entries.begin(); i != entries.end();) {
+            if (shouldRemove(i->key)) {
+                numBytes -= sizeOf(i->value);
+                index.erase(i->key);
+                i = entries.erase(i);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    /** Removes all the values. */
+    void clear() {
+        const ScopedLockType sl(lock);
+        entries.clear();
+        index.clear();
+        numBytes = 0;
+    }
+
+    //==============================================================================
+    /** Sets the most bytes of values to keep. */
+    void setMaxBytes(int64 newMaxBytes) {
+        const ScopedLockType sl(lock);
+        maxBytes = jmax((int64) 0, newMaxBytes);
+        trim();
+    }
+
+    /** Returns the limit set with setMaxBytes(). */
+    int64 getMaxBytes() const noexcept { return maxBytes; }
+
+    /** Returns the number of bytes of values currently held. */
+    int64 getNumBytes() const noexcept { return numBytes; }
+
+private:
+    //==============================================================================
+    using ScopedLockType = typename TypeOfCriticalSectionToUse::ScopedLockType;
+
+    struct Entry {
+        KeyType key;
+        ValueType value;
+    };
+
+    TypeOfCriticalSectionToUse lock;
+    std::list<Entry> entries; // most recently used first
+    std::unordered_map<KeyType, typename std::list<Entry>::iterator, HashFunction> index;
+    int64 maxBytes, numBytes = 0;
+    SizeFunction sizeOf;
+
+    void trim() {
+        while (numBytes > maxBytes && entries.size() > 1) {
+            numBytes -= sizeOf(entries.back().value);
+            index.erase(entries.back().key);
+            entries.pop_back();
+        }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LruCache)
+};
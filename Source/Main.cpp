@@ -8,8 +8,328 @@
   ==============================================================================
 */
 
+#include <iostream>
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "MainComponent.h"
+#include "ListTraceReplayer.h"
+#include "ColumnarListBoxModel.h"
+#include "AllocationCounter.h"
+#include "ListItemFeed.h"
+#include "LatencyHistogram.h"
+
+//==============================================================================
+/*
+    Replays a trace recorded with --record-trace against the demo's list and model,
+    without opening a window, then prints the frame times and quits. The exit code
+    is 1 if the 99th percentile frame time is over the --max-p99 limit, so a trace
+    from a slow machine can be used as a regression test.
+
+    With checkResizes set, the list shows a model that does nothing but paint, so that
+    only the list's own allocations are counted, and the exit code is also 1 if
+    resizing the list within a size it's already been made any allocations. That's
+    only checked in the Benchmark configuration, where allocations are counted.
+*/
+class TraceReplayHarness
+{
+public:
+    TraceReplayHarness (ListInputTrace traceToPlay, double speed, double maxP99Ms, bool checkResizes)
+        : trace (std::move (traceToPlay)), replayer (listBox, trace)
+    {
+        if (checkResizes)
+            listBox.setModel (&paintOnlyModel);
+        else
+            listBox.setModel (&model);
+
+        MainComponent::setUpListBox (listBox);
+        listBox.setVisible (true);
+
+        // the model is a ring buffer, so the columns that were dropped from the start
+        // get dropped again by adding new ones in their place
+        replayer.onColsRemovedFromStart = [this] (int numRemoved)
+        {
+            for (int i = 0; i < numRemoved; ++i)
+                model.addStringItem ("LAw");
+
+            listBox.colsRemovedFromStart (numRemoved);
+        };
+
+        replayer.onContentUpdated = [this] (int numCols)
+        {
+            while (model.getNumRows() < numCols)
+                model.addStringItem ("LAw");
+
+            listBox.updateContent();
+        };
+
+        replayer.onAllColsChanged = [this] (int numCols)
+        {
+            while (model.getNumRows() < numCols)
+                model.addStringItem ("LAw");
+
+            listBox.allColsChanged();
+        };
+
+        // the labels are only there to be painted, so rather than moving them about,
+        // the model just grows or shrinks at the end while the list is told where the
+        // columns went
+        replayer.onColsInserted = [this] (int startIndex, int numInserted)
+        {
+            for (int i = 0; i < numInserted; ++i)
+                model.addStringItem ("LAw");
+
+            listBox.colsInserted (startIndex, numInserted);
+        };
+
+        replayer.onColsRemoved = [this] (int startIndex, int numRemoved)
+        {
+            model.data.removeLast (numRemoved);
+            listBox.colsRemoved (startIndex, numRemoved);
+        };
+
+        replayer.onFinished = [maxP99Ms, checkResizes] (const ListTraceReplayer::Results& results)
+        {
+            std::cout << results.toString() << std::endl;
+
+            const auto tooSlow = maxP99Ms > 0 && results.p99 > maxP99Ms;
+            const auto resizesAllocated = checkResizes && AllocationCounter::isEnabled()
+                                            && results.numRepeatedResizeAllocations > 0;
+            finish (tooSlow || resizesAllocated ? 1 : 0);
+        };
+
+        replayer.start (speed);
+    }
+
+private:
+    static void finish (int returnValue)
+    {
+        JUCEApplicationBase::getInstance()->setApplicationReturnValue (returnValue);
+        JUCEApplicationBase::quit();
+    }
+
+    struct PaintOnlyModel  : public ListBoxModel
+    {
+        int getNumRows() override    { return 1000; }
+
+        void paintListBoxItem (int, Graphics& g, int width, int height, bool rowIsSelected) override
+        {
+            g.fillAll (rowIsSelected ? Colours::lightblue : Colours::white);
+            g.setColour (Colours::black);
+            g.drawRect (0, 0, width, height);
+        }
+    };
+
+    ListInputTrace trace;
+    TestListBoxModel model;
+    PaintOnlyModel paintOnlyModel;
+    HorizontalListBox listBox { "List", nullptr };
+    ListTraceReplayer replayer;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TraceReplayHarness)
+};
+
+//==============================================================================
+/*
+    Adds the same labels to the StringArray the demo model used to keep its items in
+    and to a ColumnarListBoxModel, and prints how fast items can be appended to each.
+    The labels are drawn from a set of a thousand, as a model's usually are. In the
+    Benchmark configuration, the memory used and allocations made per item are
+    printed too.
+*/
+static void runStorageBenchmark (int numItems)
+{
+    struct LabelModel  : public ColumnarListBoxModel<ArenaString>
+    {
+        void paintListBoxItem (int row, Graphics& g, int width, int height, bool) override
+        {
+            g.drawText (String (getText (getItems().get<0> (row))), 0, 0, width, height, Justification::centred);
+        }
+    };
+
+    StringArray labels;
+
+    for (int i = 0; i < 1000; ++i)
+        labels.add ("Clip " + String (i));
+
+    std::vector<int> labelIndices ((size_t) numItems);
+
+    for (int i = 0; i < numItems; ++i)
+        labelIndices[(size_t) i] = i % labels.size();
+
+    auto run = [numItems] (const char* name, const std::function<void()>& fill)
+    {
+        AllocationCounter counter;
+        const auto start = Time::getMillisecondCounterHiRes();
+        fill();
+        const auto seconds = (Time::getMillisecondCounterHiRes() - start) / 1000.0;
+
+        std::cout << name << ": " << String (numItems / jmax (seconds, 1.0e-9) / 1.0e6, 2) << "M items/s, ";
+
+        if (AllocationCounter::isEnabled())
+            std::cout << String (counter.getNumBytesInUse() / (double) numItems, 1) << " bytes/item, "
+                      << String (counter.getNumAllocations() / (double) numItems, 3) << " allocations/item";
+        else
+            std::cout << "allocation counting disabled";
+
+        std::cout << std::endl;
+    };
+
+    // each of these keeps its storage until the figures have been taken
+    StringArray strings;
+    LabelModel added, bulkAdded;
+
+    run ("StringArray, one at a time", [&]
+    {
+        for (auto i : labelIndices)
+            strings.add (String (labels.getReference (i).getCharPointer()));
+    });
+
+    run ("Columnar, one at a time", [&]
+    {
+        for (auto i : labelIndices)
+            added.addItem (added.intern (labels.getReference (i)));
+    });
+
+    run ("Columnar, in bulk", [&]
+    {
+        bulkAdded.addItems (labelIndices.begin(), labelIndices.end(), [&] (int i)
+        {
+            return std::make_tuple (bulkAdded.intern (labels.getReference (i)));
+        });
+    });
+
+    // the model knows its own size, so this can be shown without counting allocations
+    std::cout << "Columnar model's own figure: "
+              << String ((double) bulkAdded.getNumBytesUsed() / numItems, 1) << " bytes/item" << std::endl;
+}
+
+//==============================================================================
+/*
+    Streams items into the demo's ring-buffer model through a ListItemFeed, the way a
+    live event strip gets them, with the list following its tail, and prints how many
+    items per second got through, what each frame's drain cost on the message thread
+    (appending the batch to the model and updating the list) and how long the list
+    then took to paint.
+
+    A producer thread adds the items as fast as the feed will take them, yielding
+    whenever its queue is full, so the rate is the most the message thread can keep
+    up with. The exit code is 1 if that's under the --min-rate limit.
+*/
+class StreamingBenchmark  : private HorizontalListBox::Listener
+{
+public:
+    StreamingBenchmark (int numItemsToStream, double minItemsPerSecond)
+        : numItems (numItemsToStream), minRate (minItemsPerSecond)
+    {
+        listBox.setModel (&model);
+        MainComponent::setUpListBox (listBox);
+        listBox.setFollowsTail (true);
+        listBox.setSize (1200, 200);
+        listBox.setVisible (true);
+        listBox.addListener (this);
+
+        startTime = Time::getMillisecondCounterHiRes();
+        producer.startThread();
+    }
+
+    ~StreamingBenchmark() override
+    {
+        producer.stopThread (2000);
+        listBox.removeListener (this);
+    }
+
+private:
+    struct Producer  : public Thread
+    {
+        Producer (ListItemFeed<String>& feedToUse, int numItemsToAdd)
+            : Thread ("Streaming benchmark"), feed (feedToUse), numItems (numItemsToAdd)
+        {
+            for (int i = 0; i < 1000; ++i)
+                labels.add ("Event " + String (i));
+        }
+
+        void run() override
+        {
+            for (int i = 0; i < numItems && ! threadShouldExit();)
+            {
+                if (feed.add (labels.getReference (i % labels.size())))
+                    ++i;
+                else
+                    Thread::yield();
+            }
+        }
+
+        ListItemFeed<String>& feed;
+        const int numItems;
+        StringArray labels;
+    };
+
+    void appendItems (std::vector<String>& items)
+    {
+        drainStartTime = Time::getMillisecondCounterHiRes();
+
+        const auto numDropped = model.addStringItems (items.begin(), items.end());
+
+        if (numDropped > 0)
+            listBox.colsRemovedFromStart (numDropped);
+
+        numReceived += (int) items.size();
+    }
+
+    // the feed updates the list straight after appending, so this is the end of a drain
+    void listContentUpdated (HorizontalListBox&, int) override
+    {
+        if (drainStartTime <= 0)
+            return;
+
+        const auto drainEndTime = Time::getMillisecondCounterHiRes();
+        drainTimes.add (drainEndTime - drainStartTime);
+        drainStartTime = 0;
+
+        {
+            Graphics g (frame);
+            listBox.paintEntireComponent (g, true);
+        }
+
+        paintTimes.add (Time::getMillisecondCounterHiRes() - drainEndTime);
+
+        if (numReceived >= numItems)
+            finish (drainEndTime);
+    }
+
+    void finish (double endTime)
+    {
+        const auto seconds = (endTime - startTime) / 1000.0;
+        const auto itemsPerSecond = numReceived / jmax (seconds, 1.0e-9);
+
+        auto describe = [] (const LatencyHistogram& h)
+        {
+            return "p50: " + String (h.getPercentile (0.5), 2) + "ms"
+                 + ", p99: " + String (h.getPercentile (0.99), 2) + "ms"
+                 + ", max: " + String (h.getMax(), 2) + "ms";
+        };
+
+        std::cout << "Streamed " << numReceived << " items in " << String (seconds, 2) << "s: "
+                  << String (itemsPerSecond, 0) << " items/s, in " << (int) drainTimes.getNumValues() << " drains" << std::endl
+                  << "Drain (append + updateContent): " << describe (drainTimes) << std::endl
+                  << "Paint after each drain: " << describe (paintTimes) << std::endl;
+
+        JUCEApplicationBase::getInstance()->setApplicationReturnValue (itemsPerSecond < minRate ? 1 : 0);
+        JUCEApplicationBase::quit();
+    }
+
+    const int numItems;
+    const double minRate;
+    TestListBoxModel model;
+    HorizontalListBox listBox { "List", nullptr };
+    ListItemFeed<String> feed { listBox, [this] (std::vector<String>& items) { appendItems (items); } };
+    Producer producer { feed, numItems };
+    Image frame { Image::ARGB, 1200, 200, true };
+    LatencyHistogram drainTimes, paintTimes;
+    double startTime = 0, drainStartTime = 0;
+    int numReceived = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StreamingBenchmark)
+};
 
 //==============================================================================
 class ListBoxTestApplication  : public JUCEApplication
@@ -26,14 +346,79 @@ public:
     void initialise (const String& commandLine) override
     {
         // This method is where you should put your application's initialisation code..
+        const auto args = StringArray::fromTokens (commandLine, true);
+
+        auto getArg = [&args] (const char* name)
+        {
+            const auto index = args.indexOf (name);
+            return index >= 0 ? args[index + 1].unquoted() : String();
+        };
+
+        if (args.contains ("--replay-trace"))
+        {
+            const auto traceFile = File::getCurrentWorkingDirectory().getChildFile (getArg ("--replay-trace"));
+            const auto speed = getArg ("--speed");
+            ListInputTrace trace;
+
+            if (! trace.load (traceFile))
+            {
+                std::cerr << "Couldn't read the trace " << traceFile.getFullPathName() << std::endl;
+                setApplicationReturnValue (1);
+                quit();
+                return;
+            }
+
+            replayHarness.reset (new TraceReplayHarness (std::move (trace),
+                                                         speed.isNotEmpty() ? speed.getDoubleValue() : 1.0,
+                                                         getArg ("--max-p99").getDoubleValue(), false));
+            return;
+        }
+
+        // drags the list's width back and forth as fast as it can be rendered, timing each
+        // frame and, in the Benchmark configuration, checking that the resizes don't allocate
+        // once the list has been its widest
+        if (args.contains ("--replay-resizes"))
+        {
+            const auto sweeps = getArg ("--sweeps");
+
+            replayHarness.reset (new TraceReplayHarness (ListInputTrace::createResizeTrace ({ 200, 1600 }, 200,
+                                                                                            sweeps.isNotEmpty() ? jmax (1, sweeps.getIntValue()) : 20),
+                                                         0.0, getArg ("--max-p99").getDoubleValue(), true));
+            return;
+        }
+
+        if (args.contains ("--benchmark-storage"))
+        {
+            const auto numItems = getArg ("--items");
+            runStorageBenchmark (numItems.isNotEmpty() ? jmax (1, numItems.getIntValue()) : 1000000);
+            quit();
+            return;
+        }
+
+        if (args.contains ("--benchmark-streaming"))
+        {
+            const auto numItems = getArg ("--items");
+            const auto minRate = getArg ("--min-rate");
+
+            streamingBenchmark.reset (new StreamingBenchmark (numItems.isNotEmpty() ? jmax (1, numItems.getIntValue()) : 1000000,
+                                                              minRate.isNotEmpty() ? minRate.getDoubleValue() : 10000.0));
+            return;
+        }
 
         mainWindow.reset (new MainWindow (getApplicationName()));
+
+        if (args.contains ("--record-trace"))
+            if (auto* content = dynamic_cast<MainComponent*> (mainWindow->getContentComponent()))
+                content->startRecordingTrace (File::getCurrentWorkingDirectory()
+                                                  .getChildFile (getArg ("--record-trace")));
     }
 
     void shutdown() override
     {
         // Add your application's shutdown code here..
 
+        replayHarness = nullptr;
+        streamingBenchmark = nullptr;
         mainWindow = nullptr; // (deletes our window)
     }
 
@@ -99,6 +484,8 @@ public:
 
 private:
     std::unique_ptr<MainWindow> mainWindow;
+    std::unique_ptr<TraceReplayHarness> replayHarness;
+    std::unique_ptr<StreamingBenchmark> streamingBenchmark;
 };
 
 //==============================================================================
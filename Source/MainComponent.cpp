@@ -14,8 +14,7 @@ MainComponent::MainComponent() {
     setFramesPerSecond(60); // This sets the frequency of the update calls.
 
     listBox.setModel(&model);
-    listBox.getVerticalScrollBar().moveScrollbarInPages(1, dontSendNotification);
-    listBox.getViewport()->setScrollBarsShown(false,false);
+    setUpListBox(listBox);
 
     addAndMakeVisible(listBox);
     addAndMakeVisible(addNew);
@@ -34,12 +33,28 @@ MainComponent::MainComponent() {
     listBox.updateContent();
 
     addNew.onClick = [this] {
-        model.addStringItem("LAw");
+        if (model.addStringItem("LAw"))
+            listBox.colsRemovedFromStart(1);
+
         listBox.updateContent();
     };
 }
 
 MainComponent::~MainComponent() {
+    if (recorder != nullptr)
+        recorder->getTrace().save(recordingFile);
+}
+
+void MainComponent::startRecordingTrace(const File &traceFile) {
+    recordingFile = traceFile;
+    recorder.reset(new ListInputRecorder(listBox));
+}
+
+void MainComponent::setUpListBox(HorizontalListBox &list) {
+    list.getVerticalScrollBar().moveScrollbarInPages(1, dontSendNotification);
+    list.getViewport()->setScrollBarsShown(false,false);
+    list.setFollowsTail(true);
+    list.setColWidth(300);
 }
 
 //==============================================================================
@@ -13,6 +13,7 @@
 #include "HorizontalListBox.h"
 #include "CustomViewport.h"
 #include "TestComp.h"
+#include "ListInputTrace.h"
 
 //==============================================================================
 /*
@@ -33,6 +34,15 @@ public:
     void paint (Graphics& g) override;
     void resized() override;
 
+    //==============================================================================
+    /** Records what happens to the list, and saves it to a file when this is deleted. */
+    void startRecordingTrace(const File &traceFile);
+
+    /** Sets up a list the way the demo uses it, so that a trace can be replayed
+        against one that behaves the same.
+    */
+    static void setUpListBox(HorizontalListBox &list);
+
 private:
     //==============================================================================
     // Your private member variables go here...
@@ -44,6 +54,9 @@ private:
     TestComp testComp;
     CustomViewport viewport;
 
+    std::unique_ptr<ListInputRecorder> recorder;
+    File recordingFile;
+
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MainComponent)
 };
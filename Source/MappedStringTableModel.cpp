@@ -0,0 +1,199 @@
+/*
+  ==============================================================================
+
+    MappedStringTableModel.cpp
+    Created: 18 Oct 2026 7:15:08pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "MappedStringTableModel.h"
+
+namespace {
+    const char tableMagic[] = "HLST";
+    const int tableVersion = 1;
+    const size_t headerSize = 16, offsetSize = 8;
+}
+
+//==============================================================================
+struct MappedStringTableModel::Table {
+    static std::shared_ptr<const Table> open(const File &tableFile) {
+        std::unique_ptr<MemoryMappedFile> mapped(new MemoryMappedFile(tableFile, MemoryMappedFile::readOnly));
+
+        const auto size = (uint64) mapped->getSize();
+        auto *data = static_cast<const char *>(mapped->getData());
+
+        if (data == nullptr || size < headerSize
+            || memcmp(data, tableMagic, 4) != 0
+            || (int) ByteOrder::littleEndianInt(data + 4) != tableVersion)
+            return {};
+
+        const auto count = ByteOrder::littleEndianInt64(data + 8);
+
+        // there's one more offset than there are items
+        if (count > (uint64) std::numeric_limits<int>::max()
+            || headerSize + (count + 1) * offsetSize > size)
+            return {};
+
+        auto table = std::make_shared<Table>();
+        table->offsets = data + headerSize;
+        table->text = table->offsets + (count + 1) * offsetSize;
+        table->textSize = size - (uint64) (table->text - data);
+        table->numItems = (int) count;
+
+        if (table->getOffset(table->numItems) > table->textSize)
+            return {};
+
+        table->file = std::move(mapped);
+        return table;
+    }
+
+    uint64 getOffset(const int index) const noexcept {
+        return ByteOrder::littleEndianInt64(offsets + (size_t) index * offsetSize);
+    }
+
+    // Only the item's own offsets are checked, so a damaged file costs nothing until
+    // the damaged items are looked at.
+    StringRef getText(const int index) const noexcept {
+        if (!isPositiveAndBelow(index, numItems))
+            return {};
+
+        const auto start = getOffset(index);
+        const auto end = getOffset(index + 1);
+
+        if (start >= end || end > textSize || text[end - 1] != 0)
+            return {};
+
+        return CharPointer_UTF8(text + start);
+    }
+
+    std::unique_ptr<MemoryMappedFile> file;
+    const char *offsets = nullptr, *text = nullptr;
+    uint64 textSize = 0;
+    int numItems = 0;
+};
+
+//==============================================================================
+MappedStringTableModel::MappedStringTableModel() {}
+
+MappedStringTableModel::MappedStringTableModel(const File &tableFile) {
+    open(tableFile);
+}
+
+MappedStringTableModel::~MappedStringTableModel() {}
+
+bool MappedStringTableModel::open(const File &tableFile) {
+    auto newTable = Table::open(tableFile);
+
+    {
+        const SpinLock::ScopedLockType sl(tableLock);
+        table = newTable;
+    }
+
+    return newTable != nullptr;
+}
+
+void MappedStringTableModel::close() {
+    const SpinLock::ScopedLockType sl(tableLock);
+    table.reset();
+}
+
+int MappedStringTableModel::getNumItems() const noexcept {
+    return table != nullptr ? table->numItems : 0;
+}
+
+StringRef MappedStringTableModel::getItemText(const int index) const noexcept {
+    return table != nullptr ? table->getText(index) : StringRef();
+}
+
+std::shared_ptr<const MappedStringTableModel::Table> MappedStringTableModel::getTable() const {
+    const SpinLock::ScopedLockType sl(tableLock);
+    return table;
+}
+
+//==============================================================================
+bool MappedStringTableModel::writeFile(const File &tableFile, const int numItems,
+                                       const std::function<String(int)> &getItem) {
+    // the offsets are written as we go, and the text goes to a second file that's
+    // copied onto the end, so only one string is held in memory at a time
+    TemporaryFile temp(tableFile);
+    TemporaryFile textTemp(tableFile.withFileExtension("text"));
+
+    {
+        FileOutputStream out(temp.getFile());
+        FileOutputStream textOut(textTemp.getFile());
+
+        if (out.failedToOpen() || textOut.failedToOpen())
+            return false;
+
+        out.write(tableMagic, 4);
+        out.writeInt(tableVersion);
+        out.writeInt64(jmax(0, numItems));
+
+        int64 offset = 0;
+
+        for (int i = 0; i < numItems; ++i) {
+            out.writeInt64(offset);
+
+            const auto item = getItem(i);
+            const auto numBytes = item.getNumBytesAsUTF8() + 1; // including the terminating zero
+
+            textOut.write(item.toRawUTF8(), numBytes);
+            offset += (int64) numBytes;
+        }
+
+        out.writeInt64(offset);
+        textOut.flush();
+
+        if (textOut.getStatus().failed())
+            return false;
+
+        FileInputStream textIn(textTemp.getFile());
+
+        if (out.writeFromInputStream(textIn, -1) != offset)
+            return false;
+
+        out.flush();
+
+        if (out.getStatus().failed())
+            return false;
+    }
+
+    return temp.overwriteTargetFileWithTemporary();
+}
+
+//==============================================================================
+int MappedStringTableModel::getNumRows() {
+    return getNumItems();
+}
+
+void MappedStringTableModel::paintListBoxItem(const int rowNumber, Graphics &g, const int width, const int height,
+                                              const bool rowIsSelected) {
+    paintListBoxItemWithDetail(rowNumber, g, width, height, rowIsSelected, DetailLevel::full);
+}
+
+void MappedStringTableModel::paintListBoxItemWithDetail(const int rowNumber, Graphics &g, const int width,
+                                                        const int height, const bool rowIsSelected,
+                                                        const DetailLevel detail) {
+    auto &lf = LookAndFeel::getDefaultLookAndFeel();
+
+    if (rowIsSelected)
+        g.fillAll(lf.findColour(TextEditor::highlightColourId));
+
+    g.setColour(lf.findColour(ListBox::textColourId));
+
+    if (detail == DetailLevel::full)
+        drawCachedText(g, getItemText(rowNumber), Font(jmin(15.0f, height * 0.7f)),
+                       {4, 0, width - 8, height}, Justification::centredLeft);
+
+    g.setColour(lf.findColour(ListBox::outlineColourId));
+    g.drawVerticalLine(width - 1, 0.0f, (float) height);
+}
+
+String MappedStringTableModel::getTextForCol(const int colNumber) {
+    if (auto t = getTable())
+        return t->getText(colNumber);
+
+    return {};
+}
@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+    MappedStringTableModel.h
+    Created: 18 Oct 2026 7:15:08pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBoxModel.h"
+
+/**
+    A model that shows the strings in a string-table file, without loading them.
+
+    The file is memory-mapped, and the text of an item is read straight out of the
+    mapping when it's needed, so opening a table takes the same (very short) time
+    and memory whether it has a hundred items or fifty million. Only the pages that
+    get looked at are ever read from disk.
+
+    The file format is:
+    - a 16-byte header: the characters "HLST", a little-endian uint32 version (1),
+      and a little-endian uint64 item count
+    - (count + 1) little-endian uint64 offsets into the text that follows; the last
+      one is the size of the text
+    - the items' text, as UTF-8, each followed by a zero byte
+
+    Use writeFile() to create one. Corrupt offsets are only detected when the item
+    they belong to is read, in which case it's shown as an empty string.
+*/
+class MappedStringTableModel : public HorizontalListBoxModel {
+public:
+    MappedStringTableModel();
+
+    /** Creates a model and opens a table file. */
+    explicit MappedStringTableModel(const File &tableFile);
+
+    ~MappedStringTableModel() override;
+
+    //==============================================================================
+    /** Opens a table file, returning false if it can't be mapped or isn't a table. */
+    bool open(const File &tableFile);
+
+    /** Closes the table, leaving the model empty. */
+    void close();
+
+    /** Returns true if a table is open. */
+    bool isOpen() const noexcept { return table != nullptr; }
+
+    /** Returns the number of strings in the table. */
+    int getNumItems() const noexcept;
+
+    /** Returns an item's text as a pointer into the mapped file, without copying it.
+        The pointer stays valid until the table is closed. Out-of-range indices give
+        an empty string.
+    */
+    StringRef getItemText(int index) const noexcept;
+
+    //==============================================================================
+    /** Writes a table file containing the strings returned by a function.
+
+        The function is called once for each index, in order. The strings are streamed
+        to the file, so this doesn't need to hold them all in memory at once.
+    */
+    static bool writeFile(const File &tableFile, int numItems, const std::function<String(int)> &getItem);
+
+    //==============================================================================
+    /** @internal */
+    int getNumRows() override;
+
+    /** @internal */
+    void paintListBoxItem(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected) override;
+
+    /** @internal */
+    void paintListBoxItemWithDetail(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected,
+                                    DetailLevel detail) override;
+
+    /** @internal */
+    String getTextForCol(int colNumber) override;
+
+private:
+    //==============================================================================
+    struct Table;
+
+    // getTextForCol() is called on the search threads, so they take their own reference
+    // to the table under this lock, and a table that's closed stays mapped until they're done
+    mutable SpinLock tableLock;
+    std::shared_ptr<const Table> table;
+
+    std::shared_ptr<const Table> getTable() const;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MappedStringTableModel)
+};
@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    ModelCallStats.cpp
+    Created: 18 Oct 2026 7:28:21pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ModelCallStats.h"
+
+const char *ModelCallStats::getName(const Callback callback) noexcept {
+    switch (callback) {
+        case Callback::getNumRows:                  return "getNumRows";
+        case Callback::paintListBoxItem:            return "paintListBoxItem";
+        case Callback::refreshComponentForRow:      return "refreshComponentForRow";
+        case Callback::getMouseCursorForRow:        return "getMouseCursorForRow";
+        case Callback::getTooltipForRow:            return "getTooltipForRow";
+        case Callback::selectedRowsChanged:         return "selectedRowsChanged";
+        case Callback::listBoxItemClicked:          return "listBoxItemClicked";
+        case Callback::listBoxItemDoubleClicked:    return "listBoxItemDoubleClicked";
+        case Callback::backgroundClicked:           return "backgroundClicked";
+        case Callback::deleteKeyPressed:            return "deleteKeyPressed";
+        case Callback::returnKeyPressed:            return "returnKeyPressed";
+        case Callback::listWasScrolled:             return "listWasScrolled";
+        case Callback::getDragSourceDescription:    return "getDragSourceDescription";
+        case Callback::visibleColsChanged:          return "visibleColsChanged";
+        case Callback::numCallbacks:                break;
+    }
+
+    return "";
+}
+
+String ModelCallStats::getSummary() const {
+    String summary;
+
+    for (int i = 0; i < numCallbacks; ++i) {
+        const auto &h = histograms[(size_t) i];
+
+        if (h.getNumValues() > 0)
+            summary << String(getName((Callback) i)).paddedRight(' ', 26)
+                    << " calls: " << String((int64) h.getNumValues()).paddedLeft(' ', 8)
+                    << "  p50: " << String(h.getPercentile(0.5), 3) << "ms"
+                    << "  p99: " << String(h.getPercentile(0.99), 3) << "ms"
+                    << "  max: " << String(h.getMax(), 3) << "ms" << newLine;
+    }
+
+    return summary;
+}
+
+void ModelCallStats::clear() noexcept {
+    for (auto &h : histograms)
+        h.clear();
+}
+
+void ModelCallStats::add(const Callback callback, const int item, const double milliseconds) {
+    histograms[(size_t) callback].add(milliseconds);
+
+    if (milliseconds > slowCallThresholdMs && onSlowCall != nullptr)
+        onSlowCall(callback, item, milliseconds);
+}
+
+//==============================================================================
+void ModelCallStats::ScopedCall::finish() {
+    const auto milliseconds = Time::getMillisecondCounterHiRes() - startTime;
+
+    // the tracer's clock is the same one, in microseconds
+    if (tracer != nullptr)
+        tracer->addScope(getName(callback), startTime * 1000.0, item);
+
+    if (stats != nullptr)
+        stats->add(callback, item, milliseconds);
+}
@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+
+    ModelCallStats.h
+    Created: 18 Oct 2026 7:28:21pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "LatencyHistogram.h"
+#include "ListTracer.h"
+
+/**
+    How long a HorizontalListBox's calls into its model have taken, with a histogram
+    for each callback.
+
+    Turn it on with HorizontalListBox::setModelCallTimingEnabled(). The calls that
+    are timed are the ones the list makes on the message thread; getTextForCol(),
+    which the search calls on other threads, isn't included.
+*/
+class ModelCallStats {
+public:
+    enum class Callback {
+        getNumRows,
+        paintListBoxItem,
+        refreshComponentForRow,
+        getMouseCursorForRow,
+        getTooltipForRow,
+        selectedRowsChanged,
+        listBoxItemClicked,
+        listBoxItemDoubleClicked,
+        backgroundClicked,
+        deleteKeyPressed,
+        returnKeyPressed,
+        listWasScrolled,
+        getDragSourceDescription,
+        visibleColsChanged,
+        numCallbacks
+    };
+
+    static constexpr int numCallbacks = (int) Callback::numCallbacks;
+
+    /** Returns the name of a callback's method. */
+    static const char *getName(Callback callback) noexcept;
+
+    //==============================================================================
+    /** Returns the times of one callback. */
+    const LatencyHistogram &getHistogram(Callback callback) const noexcept {
+        return histograms[(size_t) callback];
+    }
+
+    /** Returns a table of the p50, p99 and max times of each callback that's been called. */
+    String getSummary() const;
+
+    /** Clears all the histograms. */
+    void clear() noexcept;
+
+    //==============================================================================
+    /** Sets how long a single call can take, in milliseconds, before it counts as slow. */
+    void setSlowCallThreshold(double milliseconds) noexcept { slowCallThresholdMs = milliseconds; }
+
+    /** Returns the threshold set with setSlowCallThreshold(). */
+    double getSlowCallThreshold() const noexcept { return slowCallThresholdMs; }
+
+    /** Called after a slow call, with the item it was for (or -1). */
+    std::function<void(Callback, int item, double milliseconds)> onSlowCall;
+
+    /** Adds the time of a call. */
+    void add(Callback callback, int item, double milliseconds);
+
+    //==============================================================================
+    /** Times a call for the lifetime of the scope it's declared in, if the stats
+        aren't null, and adds it to a tracer under the callback's name, if that isn't
+        null. With neither, this only tests one pointer on entering the scope and one
+        value on leaving it. The tracer is ignored when HORIZONTAL_LIST_TRACING is 0.
+    */
+    class ScopedCall {
+    public:
+        ScopedCall(ModelCallStats *s, const Callback c, const int callItem = -1, ListTracer *t = nullptr) noexcept
+                : stats(s), tracer(HORIZONTAL_LIST_TRACING ? t : nullptr), callback(c), item(callItem) {
+            if (stats != nullptr || tracer != nullptr)
+                startTime = Time::getMillisecondCounterHiRes();
+        }
+
+        ~ScopedCall() {
+            if (startTime > 0)
+                finish();
+        }
+
+    private:
+        ModelCallStats *const stats;
+        ListTracer *const tracer;
+        const Callback callback;
+        const int item;
+        double startTime = 0;
+
+        void finish();
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedCall)
+    };
+
+private:
+    //==============================================================================
+    std::array<LatencyHistogram, (size_t) numCallbacks> histograms;
+    double slowCallThresholdMs = 1000.0 / 60.0 / 2.0;
+
+    JUCE_LEAK_DETECTOR (ModelCallStats)
+};
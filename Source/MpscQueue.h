@@ -0,0 +1,110 @@
+/*
+  ==============================================================================
+
+    MpscQueue.h
+    Created: 18 Oct 2026 7:12:27pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+    A fixed-size lock-free queue that any number of threads can push to, and one
+    thread pops from.
+
+    Each slot has a sequence number that says whether it's ready to be written or
+    read, so producers only ever contend on a single atomic counter, and never wait
+    for each other or for the consumer. (JUCE's AbstractFifo only allows a single
+    producer.)
+
+    The capacity is rounded up to a power of two. When the queue is full, push()
+    fails rather than blocking, and it's up to the producer what to do about it.
+    ItemType must be default-constructible and movable.
+*/
+template <typename ItemType>
+class MpscQueue {
+public:
+    explicit MpscQueue(int minimumCapacity) {
+        jassert(minimumCapacity > 0);
+
+        auto capacity = (size_t) nextPowerOfTwo(jmax(2, minimumCapacity));
+        cells.reset(new Cell[capacity]);
+        mask = capacity - 1;
+
+        for (size_t i = 0; i < capacity; ++i)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /** Returns the number of items the queue can hold. */
+    int getCapacity() const noexcept { return (int) mask + 1; }
+
+    /** Adds an item to the back of the queue, returning false if it's full.
+        This can be called from any number of threads at once.
+    */
+    bool push(ItemType &&item) {
+        auto pos = enqueuePos.load(std::memory_order_relaxed);
+
+        for (;;) {
+            auto &cell = cells[pos & mask];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = (intptr_t) sequence - (intptr_t) pos;
+
+            if (diff == 0) {
+                // the slot's free - try to claim it
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.item = std::move(item);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // the consumer hasn't taken the item that was written here last time round
+                return false;
+            } else {
+                // another producer got this slot first
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /** Adds a copy of an item to the back of the queue, returning false if it's full. */
+    bool push(const ItemType &item) {
+        auto copy = item;
+        return push(std::move(copy));
+    }
+
+    /** Takes the item at the front of the queue, returning false if it's empty.
+        This must only be called from one thread at a time.
+    */
+    bool pop(ItemType &result) {
+        auto &cell = cells[dequeuePos & mask];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+
+        if ((intptr_t) sequence - (intptr_t) (dequeuePos + 1) < 0)
+            return false;
+
+        result = std::move(cell.item);
+        cell.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+        ++dequeuePos;
+        return true;
+    }
+
+private:
+    //==============================================================================
+    struct Cell {
+        std::atomic<size_t> sequence;
+        ItemType item;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask = 0;
+
+    // kept on separate cache lines, so that the producers and consumer don't slow each other down
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) size_t dequeuePos = 0;
+
+    JUCE_DECLARE_NON_COPYABLE (MpscQueue)
+};
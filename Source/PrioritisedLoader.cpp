@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    PrioritisedLoader.cpp
+    Created: 18 Oct 2026 7:08:08pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "PrioritisedLoader.h"
+
+// Shared with the pool's jobs, which can outlive the loader if they haven't started yet.
+struct PrioritisedLoader::State {
+    explicit State(int maxTasks) : maxWorkers(jmax(1, maxTasks)) { noRunningTasks.signal(); }
+
+    // returns the queued column nearest the centre - must be called with the lock held
+    std::map<int, Task>::iterator findNearestToCentre() {
+        auto next = pending.lower_bound(centre);
+
+        if (next == pending.begin())
+            return next;
+
+        auto previous = std::prev(next);
+
+        if (next == pending.end() || centre - previous->first < next->first - centre)
+            return previous;
+
+        return next;
+    }
+
+    CriticalSection lock;
+    std::map<int, Task> pending;
+    Array<int> running;
+    WaitableEvent noRunningTasks{true}; // signalled whenever running is empty
+    const int maxWorkers;
+    int numWorkers = 0, centre = 0;
+    bool shuttingDown = false;
+};
+
+//==============================================================================
+PrioritisedLoader::PrioritisedLoader(const int maxSimultaneousTasks)
+        : state(std::make_shared<State>(maxSimultaneousTasks)) {}
+
+PrioritisedLoader::~PrioritisedLoader() {
+    shutDown();
+}
+
+void PrioritisedLoader::shutDown() {
+    {
+        const ScopedLock sl(state->lock);
+        state->shuttingDown = true;
+        state->pending.clear();
+    }
+
+    // workers that haven't started will see that we're shutting down, but the
+    // running tasks may be using their owner, so we have to wait for them
+    state->noRunningTasks.wait();
+}
+
+void PrioritisedLoader::addTask(const int col, Task task) {
+    const ScopedLock sl(state->lock);
+
+    if (state->shuttingDown || state->running.contains(col))
+        return;
+
+    state->pending[col] = std::move(task);
+
+    if (state->numWorkers < state->maxWorkers) {
+        ++state->numWorkers;
+        pool->addJob([s = state] { runWorker(s); });
+    }
+}
+
+void PrioritisedLoader::setCentre(const int col) {
+    const ScopedLock sl(state->lock);
+    state->centre = col;
+}
+
+void PrioritisedLoader::retainOnly(const IntervalSet &colsToKeep) {
+    const ScopedLock sl(state->lock);
+    auto &pending = state->pending;
+
+    for (auto i = pending.begin(); i != pending.end();)
+        i = colsToKeep.contains(i->first) ? std::next(i) : pending.erase(i);
+}
+
+void PrioritisedLoader::clear() {
+    const ScopedLock sl(state->lock);
+    state->pending.clear();
+}
+
+bool PrioritisedLoader::isLoading(const int col) const {
+    const ScopedLock sl(state->lock);
+    return state->pending.find(col) != state->pending.end() || state->running.contains(col);
+}
+
+//==============================================================================
+void PrioritisedLoader::runWorker(std::shared_ptr<State> s) {
+    for (;;) {
+        Task task;
+        int col;
+
+        {
+            const ScopedLock sl(s->lock);
+
+            if (s->shuttingDown || s->pending.empty()) {
+                --s->numWorkers;
+                return;
+            }
+
+            auto next = s->findNearestToCentre();
+            col = next->first;
+            task = std::move(next->second);
+            s->pending.erase(next);
+
+            if (s->running.isEmpty())
+                s->noRunningTasks.reset();
+
+            s->running.add(col);
+        }
+
+        task();
+
+        const ScopedLock sl(s->lock);
+        s->running.removeFirstMatchingValue(col);
+
+        if (s->running.isEmpty())
+            s->noRunningTasks.signal();
+    }
+}
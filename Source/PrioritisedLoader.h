@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    PrioritisedLoader.h
+    Created: 18 Oct 2026 7:08:08pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "ListWorkerPool.h"
+#include "IntervalSet.h"
+
+/**
+    Runs slow per-column work (decoding images, reading files, etc.) on the
+    ListWorkerPool, doing the columns nearest the middle of the screen first.
+
+    Each task is added for a column number. Adding a task for a column that already
+    has one waiting replaces it, and tasks for columns that have scrolled too far
+    away can be dropped with retainOnly() before they've started. Only a few tasks
+    run at once, so a long queue doesn't hold up the pool's other users.
+
+    Tasks are run on the pool's threads, so anything they touch has to be safe to
+    use from there. Deleting the loader drops any tasks that haven't started and
+    waits for the ones that have, and shutDown() does the same for an owner whose
+    tasks use parts of it that are deleted before the loader.
+*/
+class PrioritisedLoader {
+public:
+    using Task = std::function<void()>;
+
+    /** Creates a loader that runs up to the given number of tasks at once. */
+    explicit PrioritisedLoader(int maxSimultaneousTasks = 2);
+
+    ~PrioritisedLoader();
+
+    //==============================================================================
+    /** Queues a task for a column. If one is already queued for that column, it's
+        replaced; if one is already running, this one is ignored.
+    */
+    void addTask(int col, Task task);
+
+    /** Sets the column that's in the middle of the screen. Queued tasks are started
+        in order of their distance from this.
+    */
+    void setCentre(int col);
+
+    /** Drops any queued tasks for columns that aren't in the given set. */
+    void retainOnly(const IntervalSet &colsToKeep);
+
+    /** Drops all the queued tasks. */
+    void clear();
+
+    /** Drops all the queued tasks and waits for the running ones to finish. Any tasks
+        added after this are ignored. This is called by the destructor.
+    */
+    void shutDown();
+
+    /** Returns true if there's a task queued or running for this column. */
+    bool isLoading(int col) const;
+
+private:
+    //==============================================================================
+    struct State;
+    std::shared_ptr<State> state;
+    SharedResourcePointer<ListWorkerPool> pool;
+
+    static void runWorker(std::shared_ptr<State> state);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PrioritisedLoader)
+};
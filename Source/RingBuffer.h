@@ -0,0 +1,111 @@
+/*
+  ==============================================================================
+
+    RingBuffer.h
+    Created: 18 Oct 2026 7:14:14pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+    A fixed-capacity list that drops its oldest item when a new one is added to it
+    while it's full.
+
+    Items stay where they were written, and logical indices (0 being the oldest item
+    that's still held) are mapped onto them, so dropping an item doesn't move any of
+    the others in memory. getNumDropped() says how many items have gone, which is
+    also the position of item 0 in the whole stream.
+
+    This isn't thread-safe - to fill one from other threads, use a ListItemFeed.
+*/
+template <typename ItemType>
+class RingBuffer {
+public:
+    explicit RingBuffer(int maxNumItems) : capacity(jmax(1, maxNumItems)) {}
+
+    /** Returns the number of items held. */
+    int size() const noexcept { return numItems; }
+
+    /** Returns true if there are no items. */
+    bool isEmpty() const noexcept { return numItems == 0; }
+
+    /** Returns the most items that can be held. */
+    int getCapacity() const noexcept { return capacity; }
+
+    /** Returns the number of items that have been dropped from the start since the buffer
+        was created or cleared.
+    */
+    int64 getNumDropped() const noexcept { return numDropped; }
+
+    //==============================================================================
+    /** Adds an item at the end, dropping the oldest item if the buffer is full.
+        Returns true if an item was dropped.
+    */
+    bool add(ItemType newItem) {
+        if (numItems < capacity) {
+            // storage only grows as far as it's needed
+            if ((int) items.size() < capacity)
+                items.push_back(std::move(newItem));
+            else
+                items[(size_t) getStorageIndex(numItems)] = std::move(newItem);
+
+            ++numItems;
+            return false;
+        }
+
+        items[(size_t) start] = std::move(newItem);
+        start = (start + 1 == capacity) ? 0 : start + 1;
+        ++numDropped;
+        return true;
+    }
+
+    /** Returns a copy of one of the items, or a default-constructed item if the index
+        is out of range.
+    */
+    ItemType operator[](int index) const {
+        return isPositiveAndBelow(index, numItems) ? items[(size_t) getStorageIndex(index)] : ItemType();
+    }
+
+    /** Returns a reference to one of the items. The index must be in range. */
+    const ItemType &getReference(int index) const noexcept {
+        jassert(isPositiveAndBelow(index, numItems));
+        return items[(size_t) getStorageIndex(index)];
+    }
+
+    /** Replaces one of the items. The index must be in range. */
+    void set(int index, ItemType newValue) {
+        jassert(isPositiveAndBelow(index, numItems));
+        items[(size_t) getStorageIndex(index)] = std::move(newValue);
+    }
+
+    /** Removes some of the newest items. */
+    void removeLast(int numToRemove) {
+        numItems -= jlimit(0, numItems, numToRemove);
+    }
+
+    /** Removes all the items and resets the drop count. */
+    void clear() {
+        items.clear();
+        start = numItems = 0;
+        numDropped = 0;
+    }
+
+private:
+    //==============================================================================
+    int getStorageIndex(int index) const noexcept {
+        const auto i = start + index;
+        return i >= capacity ? i - capacity : i;
+    }
+
+    std::vector<ItemType> items;
+    const int capacity;
+    int start = 0, numItems = 0;
+    int64 numDropped = 0;
+
+    JUCE_LEAK_DETECTOR (RingBuffer)
+};
@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    StringArena.cpp
+    Created: 18 Oct 2026 7:17:13pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "StringArena.h"
+
+namespace {
+    const size_t arenaBlockSize = 64 * 1024;
+}
+
+StringArena::StringArena() {
+    clear();
+}
+
+StringArena::~StringArena() {}
+
+//==============================================================================
+ArenaString StringArena::intern(StringRef text) {
+    auto *utf8 = text.text.getAddress();
+    const auto numBytes = text.text.sizeInBytes() - 1;
+    const auto h = hash(utf8, numBytes);
+
+    // kept under 70% full, so that the probe sequences stay short
+    if ((strings.size() + 1) * 10 > slots.size() * 7)
+        growTable();
+
+    const auto mask = slots.size() - 1;
+
+    for (auto slot = (size_t) h & mask;; slot = (slot + 1) & mask) {
+        if (slots[slot] == 0) {
+            strings.push_back({store(utf8, numBytes), (uint32) numBytes, h});
+            slots[slot] = (uint32) strings.size();
+            return {(uint32) strings.size() - 1};
+        }
+
+        auto &e = strings[slots[slot] - 1];
+
+        if (e.hash == h && e.numBytes == numBytes && memcmp(e.text, utf8, numBytes) == 0)
+            return {slots[slot] - 1};
+    }
+}
+
+StringRef StringArena::get(const ArenaString handle) const noexcept {
+    jassert(handle.id < strings.size());
+    return CharPointer_UTF8(strings[handle.id].text);
+}
+
+size_t StringArena::getNumBytesUsed() const noexcept {
+    return numBlockBytes
+           + strings.capacity() * sizeof(Entry)
+           + slots.capacity() * sizeof(uint32)
+           + blocks.capacity() * sizeof(std::unique_ptr<char[]>);
+}
+
+void StringArena::clear() {
+    blocks.clear();
+    strings.clear();
+    slots.assign(16, 0);
+    spaceLeftInBlock = numBlockBytes = 0;
+    nextFree = nullptr;
+
+    intern({});
+}
+
+void StringArena::swapWith(StringArena &other) noexcept {
+    blocks.swap(other.blocks);
+    strings.swap(other.strings);
+    slots.swap(other.slots);
+    std::swap(spaceLeftInBlock, other.spaceLeftInBlock);
+    std::swap(numBlockBytes, other.numBlockBytes);
+    std::swap(nextFree, other.nextFree);
+}
+
+//==============================================================================
+const char *StringArena::store(const char *text, const size_t numBytes) {
+    const auto size = numBytes + 1;
+    char *dest;
+
+    if (size > arenaBlockSize / 4) {
+        // big strings get a block of their own, so they don't waste the rest of a shared one
+        blocks.emplace_back(new char[size]);
+        dest = blocks.back().get();
+        numBlockBytes += size;
+    } else {
+        if (size > spaceLeftInBlock) {
+            blocks.emplace_back(new char[arenaBlockSize]);
+            nextFree = blocks.back().get();
+            spaceLeftInBlock = arenaBlockSize;
+            numBlockBytes += arenaBlockSize;
+        }
+
+        dest = nextFree;
+        nextFree += size;
+        spaceLeftInBlock -= size;
+    }
+
+    memcpy(dest, text, numBytes);
+    dest[numBytes] = 0;
+    return dest;
+}
+
+void StringArena::growTable() {
+    std::vector<uint32> newSlots(slots.size() * 2, 0);
+    const auto mask = newSlots.size() - 1;
+
+    for (size_t i = 0; i < strings.size(); ++i) {
+        auto slot = (size_t) strings[i].hash & mask;
+
+        while (newSlots[slot] != 0)
+            slot = (slot + 1) & mask;
+
+        newSlots[slot] = (uint32) i + 1;
+    }
+
+    slots.swap(newSlots);
+}
+
+uint32 StringArena::hash(const char *text, const size_t numBytes) noexcept {
+    // FNV-1a
+    uint32 h = 2166136261u;
+
+    for (size_t i = 0; i < numBytes; ++i)
+        h = (h ^ (uint8) text[i]) * 16777619u;
+
+    return h;
+}
@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    StringArena.h
+    Created: 18 Oct 2026 7:17:13pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/** A handle to a string that's been interned in a StringArena. The default one is
+    the empty string.
+*/
+struct ArenaString {
+    uint32 id = 0;
+
+    bool operator==(ArenaString other) const noexcept { return id == other.id; }
+    bool operator!=(ArenaString other) const noexcept { return id != other.id; }
+};
+
+/**
+    Stores strings as UTF-8 in large shared blocks, keeping only one copy of each
+    distinct string.
+
+    Interning a string gives back a 4-byte ArenaString handle, so a model that has
+    millions of items with a few thousand distinct labels stores a few thousand strings
+    rather than millions of separately-allocated String objects. Strings are never
+    moved or freed until the arena is cleared, so the text you get back stays valid.
+
+    That also means an arena only grows. If the items using it are being dropped and
+    replaced with ones that have new strings, re-intern the live items' strings into a
+    fresh arena now and then, and swap it in with swapWith().
+
+    This isn't thread-safe.
+*/
+class StringArena {
+public:
+    StringArena();
+
+    ~StringArena();
+
+    //==============================================================================
+    /** Returns the handle for a string, adding it to the arena if it's not there yet. */
+    ArenaString intern(StringRef text);
+
+    /** Returns the text of an interned string, without copying it. */
+    StringRef get(ArenaString handle) const noexcept;
+
+    /** Returns the number of distinct strings held, including the empty string. */
+    int getNumStrings() const noexcept { return (int) strings.size(); }
+
+    /** Returns roughly how much memory the arena is using, in bytes. */
+    size_t getNumBytesUsed() const noexcept;
+
+    /** Removes all the strings, invalidating every handle except the empty string's. */
+    void clear();
+
+    /** Swaps the contents of two arenas. Handles and text from either one stay valid,
+        but now belong to the other.
+    */
+    void swapWith(StringArena &other) noexcept;
+
+private:
+    //==============================================================================
+    struct Entry {
+        const char *text;
+        uint32 numBytes, hash;
+    };
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    size_t spaceLeftInBlock = 0, numBlockBytes = 0;
+    char *nextFree = nullptr;
+
+    std::vector<Entry> strings;
+    std::vector<uint32> slots; // open-addressed hash table of string index + 1, or 0 if empty
+
+    const char *store(const char *text, size_t numBytes);
+
+    void growTable();
+
+    static uint32 hash(const char *text, size_t numBytes) noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StringArena)
+};
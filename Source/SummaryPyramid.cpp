@@ -0,0 +1,142 @@
+/*
+  ==============================================================================
+
+    SummaryPyramid.cpp
+    Created: 18 Oct 2026 7:22:18pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "SummaryPyramid.h"
+
+void SummaryPyramid::setValues(const float *newValues, const int64 numValues) {
+    values.assign(newValues, newValues + jmax((int64) 0, numValues));
+    levels.clear();
+    updateLevelsFrom(0);
+}
+
+void SummaryPyramid::addValues(const float *newValues, const int numValues) {
+    if (numValues <= 0)
+        return;
+
+    const auto oldSize = getNumValues();
+    values.insert(values.end(), newValues, newValues + numValues);
+    updateLevelsFrom(oldSize);
+}
+
+void SummaryPyramid::clear() {
+    values.clear();
+    levels.clear();
+}
+
+//==============================================================================
+Range<float> SummaryPyramid::getRange(int64 start, int64 end) const noexcept {
+    start = jmax((int64) 0, start);
+    end = jmin(getNumValues(), end);
+
+    if (start >= end)
+        return {};
+
+    auto low = std::numeric_limits<float>::max();
+    auto high = std::numeric_limits<float>::lowest();
+
+    auto take = [&low, &high](const float min, const float max) {
+        low = jmin(low, min);
+        high = jmax(high, max);
+    };
+
+    // the odd values at each end don't make up a whole entry on the level above
+    if (start & 1) {
+        take(values[(size_t) start], values[(size_t) start]);
+        ++start;
+    }
+
+    if (end & 1) {
+        --end;
+        take(values[(size_t) end], values[(size_t) end]);
+    }
+
+    start >>= 1;
+    end >>= 1;
+
+    for (size_t level = 0; start < end; ++level) {
+        const auto &entries = levels[level];
+
+        if (start & 1) {
+            take(entries[(size_t) start].min, entries[(size_t) start].max);
+            ++start;
+        }
+
+        if (end & 1) {
+            --end;
+            take(entries[(size_t) end].min, entries[(size_t) end].max);
+        }
+
+        start >>= 1;
+        end >>= 1;
+    }
+
+    return {low, high};
+}
+
+void SummaryPyramid::getRanges(const int64 start, const int64 end, Range<float> *dest,
+                               const int numParts) const noexcept {
+    const auto length = end - start;
+
+    for (int i = 0; i < numParts; ++i) {
+        const auto partStart = start + length * i / numParts;
+        dest[i] = getRange(partStart, jmax(partStart + 1, start + length * (i + 1) / numParts));
+    }
+}
+
+size_t SummaryPyramid::getNumBytesUsed() const noexcept {
+    auto total = values.capacity() * sizeof(float);
+
+    for (auto &level : levels)
+        total += level.capacity() * sizeof(MinMax);
+
+    return total;
+}
+
+//==============================================================================
+void SummaryPyramid::updateLevelsFrom(const int64 firstChangedValue) {
+    auto first = (size_t) firstChangedValue / 2;
+    auto belowSize = values.size();
+
+    // level 0 is built from the values themselves
+    if (belowSize > 1) {
+        if (levels.empty())
+            levels.emplace_back();
+
+        auto &level = levels[0];
+        level.resize((belowSize + 1) / 2);
+
+        for (auto i = first; i < level.size(); ++i) {
+            const auto a = values[i * 2];
+            const auto b = i * 2 + 1 < belowSize ? values[i * 2 + 1] : a;
+            level[i] = {jmin(a, b), jmax(a, b)};
+        }
+
+        belowSize = level.size();
+    }
+
+    for (size_t n = 1; belowSize > 1; ++n) {
+        first /= 2;
+
+        if (levels.size() <= n)
+            levels.emplace_back();
+
+        const auto &below = levels[n - 1];
+        auto &level = levels[n];
+        level.resize((belowSize + 1) / 2);
+
+        for (auto i = first; i < level.size(); ++i) {
+            const auto &a = below[i * 2];
+            const auto &b = i * 2 + 1 < belowSize ? below[i * 2 + 1] : a;
+            level[i] = {jmin(a.min, b.min), jmax(a.max, b.max)};
+        }
+
+        belowSize = level.size();
+    }
+}
@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    SummaryPyramid.h
+    Created: 18 Oct 2026 7:22:18pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+    A series of values, with precomputed summaries that give the minimum and maximum
+    of any stretch of them in O(log n) time.
+
+    The summaries are a pyramid of levels, each one half the size of the one below
+    it, where every entry holds the min and max of the two entries beneath it. A query
+    takes whole entries from the highest level that fits and only looks at a few on
+    each level. So drawing a stretch of a million values into a hundred pixels reads a
+    few thousand entries rather than a million values, whatever the zoom level.
+
+    Values can be appended, and only the summaries they affect are updated. The
+    summaries take up about twice as much memory as the values.
+
+    This isn't thread-safe.
+*/
+class SummaryPyramid {
+public:
+    SummaryPyramid() = default;
+
+    //==============================================================================
+    /** Replaces all the values. */
+    void setValues(const float *newValues, int64 numValues);
+
+    /** Adds values to the end. */
+    void addValues(const float *newValues, int numValues);
+
+    /** Removes all the values. */
+    void clear();
+
+    /** Returns the number of values. */
+    int64 getNumValues() const noexcept { return (int64) values.size(); }
+
+    //==============================================================================
+    /** Returns the lowest and highest values in the range [start, end). The range is
+        clipped to the values there are, and an empty range gives an empty Range.
+    */
+    Range<float> getRange(int64 start, int64 end) const noexcept;
+
+    /** Splits the range [start, end) into a number of equal parts and writes the
+        lowest and highest values in each one to dest. If the range holds fewer
+        values than there are parts, some values will be used for more than one part.
+    */
+    void getRanges(int64 start, int64 end, Range<float> *dest, int numParts) const noexcept;
+
+    /** Returns roughly how much memory this is using, in bytes. */
+    size_t getNumBytesUsed() const noexcept;
+
+private:
+    //==============================================================================
+    struct MinMax {
+        float min, max;
+    };
+
+    std::vector<float> values;
+
+    // levels[0] has one entry for every two values, and each level above has one
+    // entry for every two entries below; the last entry may only have one beneath it
+    std::vector<std::vector<MinMax>> levels;
+
+    void updateLevelsFrom(int64 firstChangedValue);
+
+    JUCE_LEAK_DETECTOR (SummaryPyramid)
+};
@@ -13,11 +13,15 @@
 #pragma once
 
 #include "JuceHeader.h"
+#include "HorizontalListBoxModel.h"
+#include "RingBuffer.h"
+#include "StringArena.h"
 
-struct TestListBoxModel: public ListBoxModel{
+struct TestListBoxModel: public HorizontalListBoxModel{
 
     TestListBoxModel(){
-        data = StringArray("One", "Two");
+        addStringItem ("One");
+        addStringItem ("Two");
     }
 
 
@@ -26,22 +30,100 @@ struct TestListBoxModel: public ListBoxModel{
     }
 
     void paintListBoxItem(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected) override {
+        paintListBoxItemWithDetail (rowNumber, g, width, height, rowIsSelected, DetailLevel::full);
+    }
+
+    void paintListBoxItemWithDetail(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected,
+                                    DetailLevel detail) override {
         if(rowIsSelected)
             g.fillAll(Colours::aliceblue);
 
         g.setColour (LookAndFeel::getDefaultLookAndFeel().findColour (Label::textColourId));
-        g.setFont (height * 0.2f);
 
-        g.drawText (data[rowNumber] + String (rowNumber + 1),
-                    5, 0, width, height,
-                    Justification::centredLeft, true);
+        // nobody can read the labels while they're flying past, so just show where they are
+        if (detail == DetailLevel::reduced) {
+            g.setOpacity (0.3f);
+            g.fillRect (5, height / 2 - 2, width / 2, 4);
+            g.setOpacity (1.0f);
+            g.drawRect(0,0,width, height);
+            return;
+        }
+
+        drawCachedText (g, getItemText (rowNumber), getFontForHeight (height),
+                        { 5, 0, width, height },
+                        Justification::centredLeft, true);
         g.drawRect(0,0,width, height);
 
     }
 
-    void addStringItem(String item){
-        data.add(std::move(item));
+    void visibleColsChanged(Range<int>, Range<int> colsToPrefetch, int colWidth, int colHeight) override {
+        StringArray texts;
+
+        for (auto i = colsToPrefetch.getStart(); i < colsToPrefetch.getEnd(); ++i)
+            texts.add (getItemText (i));
+
+        prepareCachedTextAsync (texts, getFontForHeight (colHeight),
+                                { 5, 0, colWidth, colHeight },
+                                Justification::centredLeft, true);
+    }
+
+    String getItemText(int rowNumber) const {
+        // numbered by position in the whole stream, so labels don't change as old items are dropped
+        return String (strings.get (data[rowNumber])) + String (data.getNumDropped() + rowNumber + 1);
+    }
+
+    const Font &getFontForHeight(int height){
+        if (height != fontHeight) {
+            font = Font (height * 0.2f);
+            fontHeight = height;
+        }
+
+        return font;
+    }
+
+    /** Returns true if the oldest item had to be dropped to make room. */
+    bool addStringItem(StringRef item){
+        compactStringsIfNeeded();
+        return data.add(strings.intern(item));
     }
 
-    StringArray data;
+    /** Adds a range of strings, returning how many of the oldest items were dropped. */
+    template <typename Iterator>
+    int addStringItems(Iterator first, Iterator last){
+        int numDropped = 0;
+
+        for (; first != last; ++first) {
+            compactStringsIfNeeded();
+
+            if (data.add(strings.intern(*first)))
+                ++numDropped;
+        }
+
+        return numDropped;
+    }
+
+    // the items are handles into the arena, so adding one doesn't allocate a String
+    RingBuffer<ArenaString> data { 100000 };
+    StringArena strings;
+
+private:
+    Font font;
+    int fontHeight = -1;
+
+    // The arena never frees a string, so a stream of distinct labels would make it grow
+    // forever while the ring buffer stays the same size. Once it holds more strings than
+    // twice the buffer's capacity, at least half of them must belong to dropped items, so
+    // the live ones are moved to a fresh arena. That's one pass over the buffer for every
+    // capacity's worth of new strings, so it costs O(1) per item on average.
+    void compactStringsIfNeeded(){
+        if (strings.getNumStrings() <= data.getCapacity() * 2)
+            return;
+
+        StringArena live;
+
+        for (int i = 0; i < data.size(); ++i)
+            data.set (i, live.intern (strings.get (data.getReference (i))));
+
+        strings.swapWith (live);
+    }
 };
@@ -0,0 +1,159 @@
+/*
+  ==============================================================================
+
+    TextLayoutCache.cpp
+    Created: 18 Oct 2026 7:06:19pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "TextLayoutCache.h"
+
+struct TextLayoutCache::Key {
+    bool operator==(const Key &other) const noexcept {
+        return width == other.width
+               && height == other.height
+               && justification == other.justification
+               && useEllipses == other.useEllipses
+               && text == other.text
+               && font == other.font;
+    }
+
+    struct Hash {
+        size_t operator()(const Key &k) const noexcept {
+            auto h = (uint64) k.text.hashCode64();
+            h = h * 31 + (uint64) k.font.getTypefaceName().hashCode64();
+            h = h * 31 + (uint64) roundToInt(k.font.getHeight() * 64.0f);
+            h = h * 31 + (uint64) k.font.getStyleFlags();
+            h = h * 31 + (uint64) k.width;
+            h = h * 31 + (uint64) k.height;
+            h = h * 31 + (uint64) k.justification;
+            return (size_t) h;
+        }
+    };
+
+    String text;
+    Font font;
+    int width, height, justification;
+    bool useEllipses;
+};
+
+//==============================================================================
+// The jobs queued by prepareAsync() keep this alive, so they can still finish
+// safely if the cache is deleted before they run.
+struct TextLayoutCache::Store {
+    using Glyphs = std::shared_ptr<const GlyphArrangement>;
+
+    struct Entry {
+        Key key;
+        Glyphs glyphs;
+    };
+
+    Glyphs find(const Key &key) {
+        const ScopedLock sl(lock);
+        auto found = index.find(key);
+
+        if (found == index.end())
+            return {};
+
+        entries.splice(entries.begin(), entries, found->second);
+        return found->second->glyphs;
+    }
+
+    Glyphs findOrCreate(const Key &key) {
+        if (auto glyphs = find(key))
+            return glyphs;
+
+        // the layout is done outside the lock, so that threads preparing other
+        // entries aren't held up by it
+        auto glyphs = layOut(key);
+
+        const ScopedLock sl(lock);
+
+        if (index.find(key) == index.end()) {
+            entries.push_front({key, glyphs});
+            index[key] = entries.begin();
+            trim();
+        }
+
+        return glyphs;
+    }
+
+    void trim() {
+        while ((int) entries.size() > maxEntries) {
+            index.erase(entries.back().key);
+            entries.pop_back();
+        }
+    }
+
+    static Glyphs layOut(const Key &key) {
+        auto glyphs = std::make_shared<GlyphArrangement>();
+        glyphs->addCurtailedLineOfText(key.font, key.text, 0.0f, 0.0f, (float) key.width, key.useEllipses);
+        glyphs->justifyGlyphs(0, glyphs->getNumGlyphs(), 0.0f, 0.0f, (float) key.width, (float) key.height,
+                              Justification(key.justification));
+        return glyphs;
+    }
+
+    CriticalSection lock;
+    std::list<Entry> entries; // most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, Key::Hash> index;
+    int maxEntries = 4096;
+};
+
+//==============================================================================
+TextLayoutCache::TextLayoutCache() : store(std::make_shared<Store>()) {}
+
+TextLayoutCache::~TextLayoutCache() {}
+
+void TextLayoutCache::drawText(Graphics &g, const String &text, const Font &font, Rectangle<int> area,
+                               Justification justification, bool useEllipsesIfTooBig) {
+    if (text.isEmpty() || area.isEmpty() || !g.clipRegionIntersects(area))
+        return;
+
+    if (auto glyphs = store->findOrCreate({text, font, area.getWidth(), area.getHeight(),
+                                           justification.getFlags(), useEllipsesIfTooBig}))
+        glyphs->draw(g, AffineTransform::translation((float) area.getX(), (float) area.getY()));
+}
+
+void TextLayoutCache::prepare(const String &text, const Font &font, int width, int height,
+                              Justification justification, bool useEllipsesIfTooBig) {
+    if (text.isNotEmpty() && width > 0 && height > 0)
+        store->findOrCreate({text, font, width, height, justification.getFlags(), useEllipsesIfTooBig});
+}
+
+void TextLayoutCache::prepareAsync(const StringArray &texts, const Font &font, int width, int height,
+                                   Justification justification, bool useEllipsesIfTooBig) {
+    if (texts.isEmpty() || width <= 0 || height <= 0)
+        return;
+
+    // Fonts share their internal state between copies, and that state gets filled in lazily
+    // when the typeface is first needed, so the job gets a font of its own to use.
+    auto jobFont = Font(font.getTypefaceName(), font.getTypefaceStyle(), font.getHeight())
+            .withHorizontalScale(font.getHorizontalScale())
+            .withExtraKerningFactor(font.getExtraKerningFactor());
+
+    pool->addJob([s = store, texts, jobFont, width, height, flags = justification.getFlags(), useEllipsesIfTooBig] {
+        for (auto &text : texts)
+            if (text.isNotEmpty())
+                s->findOrCreate({text, jobFont, width, height, flags, useEllipsesIfTooBig});
+    });
+}
+
+//==============================================================================
+void TextLayoutCache::setMaximumNumEntries(int maxEntries) {
+    const ScopedLock sl(store->lock);
+    store->maxEntries = jmax(1, maxEntries);
+    store->trim();
+}
+
+int TextLayoutCache::getNumEntries() const {
+    const ScopedLock sl(store->lock);
+    return (int) store->entries.size();
+}
+
+void TextLayoutCache::clear() {
+    const ScopedLock sl(store->lock);
+    store->index.clear();
+    store->entries.clear();
+}
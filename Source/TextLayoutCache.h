@@ -0,0 +1,73 @@
+/*
+  ==============================================================================
+
+    TextLayoutCache.h
+    Created: 18 Oct 2026 7:06:19pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "ListWorkerPool.h"
+
+/**
+    A cache of laid-out lines of text, so that painting the same text again doesn't
+    have to re-shape its glyphs.
+
+    Each entry is keyed by the text, font, size of the area and justification, and
+    the least recently used entries are thrown away when the cache is full. Entries
+    can also be laid out ahead of time on the ListWorkerPool with prepareAsync(),
+    e.g. for columns that are about to scroll into view.
+
+    This is usually used through a SharedResourcePointer - HorizontalListBoxModel's
+    drawCachedText() does that for you.
+*/
+class TextLayoutCache {
+public:
+    TextLayoutCache();
+
+    ~TextLayoutCache();
+
+    //==============================================================================
+    /** Draws a line of text in the same way as Graphics::drawText(), but using a cached
+        layout if there is one, and caching the layout if there isn't.
+        The text is drawn in the Graphics context's current colour.
+    */
+    void drawText(Graphics &g, const String &text, const Font &font, Rectangle<int> area,
+                  Justification justification, bool useEllipsesIfTooBig = true);
+
+    /** Lays out some text and adds it to the cache, if it's not already there.
+        This can be called on any thread.
+    */
+    void prepare(const String &text, const Font &font, int width, int height,
+                 Justification justification, bool useEllipsesIfTooBig = true);
+
+    /** Lays out some lines of text on the ListWorkerPool, so that later calls to
+        drawText() with the same settings will find them in the cache.
+    */
+    void prepareAsync(const StringArray &texts, const Font &font, int width, int height,
+                      Justification justification, bool useEllipsesIfTooBig = true);
+
+    //==============================================================================
+    /** Sets the number of layouts to keep. The default is 4096. */
+    void setMaximumNumEntries(int maxEntries);
+
+    /** Returns the number of layouts currently in the cache. */
+    int getNumEntries() const;
+
+    /** Removes all the layouts from the cache. */
+    void clear();
+
+private:
+    //==============================================================================
+    struct Key;
+    struct Store;
+
+    std::shared_ptr<Store> store;
+    SharedResourcePointer<ListWorkerPool> pool;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TextLayoutCache)
+};
@@ -0,0 +1,125 @@
+/*
+  ==============================================================================
+
+    TimelineModel.cpp
+    Created: 18 Oct 2026 7:22:18pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "TimelineModel.h"
+
+TimelineModel::TimelineModel() {}
+
+TimelineModel::~TimelineModel() {}
+
+void TimelineModel::setSamples(const float *samples, const int64 numSamples, const double newSampleRate) {
+    jassert(newSampleRate > 0);
+
+    sampleRate = newSampleRate;
+    pyramid.setValues(samples, numSamples);
+    updateSamplesPerCol();
+    update();
+}
+
+void TimelineModel::addSamples(const float *samples, const int numSamples) {
+    // only the last column changes, unless the new samples start new ones
+    const auto oldNumCols = getNumRows();
+    pyramid.addValues(samples, numSamples);
+
+    if (listBox == nullptr)
+        return;
+
+    if (oldNumCols > 0)
+        listBox->repaintCol(oldNumCols - 1);
+
+    if (getNumRows() != oldNumCols)
+        listBox->updateContent();
+}
+
+void TimelineModel::setSecondsPerCol(const double newSecondsPerCol) {
+    jassert(newSecondsPerCol > 0);
+
+    secondsPerCol = newSecondsPerCol;
+    updateSamplesPerCol();
+    update();
+}
+
+double TimelineModel::getTimeOfCol(const int col) const noexcept {
+    return (double) col * samplesPerCol / sampleRate;
+}
+
+void TimelineModel::updateSamplesPerCol() {
+    samplesPerCol = jmax((int64) 1, (int64) std::llround(secondsPerCol * sampleRate));
+}
+
+void TimelineModel::update() {
+    if (listBox != nullptr)
+        listBox->allColsChanged();
+}
+
+//==============================================================================
+int TimelineModel::getNumRows() {
+    return (int) jmin((int64) std::numeric_limits<int>::max(),
+                      (pyramid.getNumValues() + samplesPerCol - 1) / samplesPerCol);
+}
+
+void TimelineModel::paintListBoxItem(const int rowNumber, Graphics &g, const int width, const int height,
+                                     const bool rowIsSelected) {
+    paintListBoxItemWithDetail(rowNumber, g, width, height, rowIsSelected, DetailLevel::full);
+}
+
+void TimelineModel::paintListBoxItemWithDetail(const int rowNumber, Graphics &g, const int width,
+                                               const int height, const bool rowIsSelected,
+                                               const DetailLevel detail) {
+    auto &lf = LookAndFeel::getDefaultLookAndFeel();
+
+    if (rowIsSelected)
+        g.fillAll(lf.findColour(TextEditor::highlightColourId).withMultipliedAlpha(0.5f));
+
+    const auto start = (int64) rowNumber * samplesPerCol;
+    const auto end = jmin(pyramid.getNumValues(), start + samplesPerCol);
+
+    // the last column may only be partly filled
+    const auto filledWidth = (int) (width * (end - start) / samplesPerCol);
+
+    if (filledWidth > 0) {
+        const auto pixelStep = detail == DetailLevel::reduced ? 4 : 1;
+        const auto numBars = (filledWidth + pixelStep - 1) / pixelStep;
+
+        if ((int) pixelRanges.size() < numBars)
+            pixelRanges.resize((size_t) numBars);
+
+        pyramid.getRanges(start, end, pixelRanges.data(), numBars);
+
+        const auto halfHeight = height * 0.5f;
+        RectangleList<float> bars;
+        bars.ensureStorageAllocated(numBars);
+
+        for (int i = 0; i < numBars; ++i) {
+            const auto top = jlimit(-1.0f, 1.0f, pixelRanges[(size_t) i].getEnd());
+            const auto bottom = jlimit(-1.0f, 1.0f, pixelRanges[(size_t) i].getStart());
+
+            bars.addWithoutMerging({(float) (i * pixelStep), halfHeight - top * halfHeight,
+                                    (float) pixelStep, jmax(1.0f, (top - bottom) * halfHeight)});
+        }
+
+        g.setColour(lf.findColour(ListBox::textColourId).withMultipliedAlpha(0.8f));
+        g.fillRectList(bars);
+    }
+
+    g.setColour(lf.findColour(ListBox::outlineColourId));
+    g.drawVerticalLine(0, 0.0f, (float) height);
+
+    if (detail == DetailLevel::full && width >= 40)
+        drawCachedText(g, getTextForCol(rowNumber), Font(11.0f), {3, 2, width - 6, 14},
+                       Justification::centredLeft);
+}
+
+String TimelineModel::getTextForCol(const int colNumber) {
+    const auto seconds = getTimeOfCol(colNumber);
+    const auto minutes = (int) (seconds / 60);
+
+    return String(minutes) + ":" + String(seconds - minutes * 60, 3).paddedLeft('0', 6);
+}
@@ -0,0 +1,84 @@
+/*
+  ==============================================================================
+
+    TimelineModel.h
+    Created: 18 Oct 2026 7:22:18pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBox.h"
+#include "SummaryPyramid.h"
+
+/**
+    A model that uses the list as a time axis: each column is a fixed slice of time,
+    showing the minimum and maximum of the samples in it.
+
+    The samples are held in a SummaryPyramid, so painting a column reads a few
+    summary entries per pixel however many samples the slice holds, and zooming the
+    list (see HorizontalListBox::zoomToColWidth()) doesn't make painting any slower.
+
+    Give it the HorizontalListBox that's displaying it with setListBox(), so that it
+    can update the list when samples are added.
+*/
+class TimelineModel : public HorizontalListBoxModel {
+public:
+    TimelineModel();
+
+    ~TimelineModel() override;
+
+    /** Sets the list that should be updated when the samples change.
+        The list should be using this as its model.
+    */
+    void setListBox(HorizontalListBox *listToUpdate) noexcept { listBox = listToUpdate; }
+
+    //==============================================================================
+    /** Replaces the samples. */
+    void setSamples(const float *samples, int64 numSamples, double sampleRate);
+
+    /** Adds samples to the end. */
+    void addSamples(const float *samples, int numSamples);
+
+    /** Returns the number of samples. */
+    int64 getNumSamples() const noexcept { return pyramid.getNumValues(); }
+
+    /** Sets the length of time that each column shows. The default is one second. */
+    void setSecondsPerCol(double newSecondsPerCol);
+
+    /** Returns the time at the start of a column, in seconds. */
+    double getTimeOfCol(int col) const noexcept;
+
+    //==============================================================================
+    /** @internal */
+    int getNumRows() override;
+
+    /** @internal */
+    void paintListBoxItem(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected) override;
+
+    /** @internal */
+    void paintListBoxItemWithDetail(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected,
+                                    DetailLevel detail) override;
+
+    /** @internal */
+    String getTextForCol(int colNumber) override;
+
+private:
+    //==============================================================================
+    Component::SafePointer<HorizontalListBox> listBox;
+    SummaryPyramid pyramid;
+    double sampleRate = 44100.0, secondsPerCol = 1.0;
+    int64 samplesPerCol = 44100;
+
+    // reused between paints, so that painting doesn't allocate
+    std::vector<Range<float>> pixelRanges;
+
+    void updateSamplesPerCol();
+
+    void update();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TimelineModel)
+};
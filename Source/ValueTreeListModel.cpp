@@ -0,0 +1,159 @@
+/*
+  ==============================================================================
+
+    ValueTreeListModel.cpp
+    Created: 18 Oct 2026 7:36:43pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#include "ValueTreeListModel.h"
+
+ValueTreeListModel::ValueTreeListModel(const ValueTree &parentTree) {
+    setTree(parentTree);
+}
+
+ValueTreeListModel::~ValueTreeListModel() {
+    tree.removeListener(this);
+}
+
+//==============================================================================
+void ValueTreeListModel::setTree(const ValueTree &newParentTree) {
+    tree.removeListener(this);
+    tree = newParentTree;
+    tree.addListener(this);
+
+    updateAll();
+}
+
+void ValueTreeListModel::flushChanges() {
+    cancelPendingUpdate();
+    handleAsyncUpdate();
+}
+
+//==============================================================================
+void ValueTreeListModel::valueTreePropertyChanged(ValueTree &changedTree, const Identifier &) {
+    // the change can be anywhere inside a child, so find which child it's in
+    auto child = changedTree;
+
+    while (child.isValid() && child.getParent() != tree)
+        child = child.getParent();
+
+    if (child.isValid() && !needsFullUpdate) {
+        changedChildren.addIfNotAlreadyThere(child);
+        triggerAsyncUpdate();
+    }
+}
+
+void ValueTreeListModel::valueTreeChildAdded(ValueTree &parentTree, ValueTree &child) {
+    if (parentTree == tree)
+        addChange({Change::Type::added, parentTree.indexOf(child), -1, child});
+}
+
+void ValueTreeListModel::valueTreeChildRemoved(ValueTree &parentTree, ValueTree &child, const int index) {
+    if (parentTree == tree)
+        addChange({Change::Type::removed, index, -1, child});
+}
+
+void ValueTreeListModel::valueTreeChildOrderChanged(ValueTree &parentTree, const int oldIndex, const int newIndex) {
+    if (parentTree == tree)
+        addChange({Change::Type::moved, oldIndex, newIndex, {}});
+}
+
+void ValueTreeListModel::valueTreeParentChanged(ValueTree &) {}
+
+void ValueTreeListModel::valueTreeRedirected(ValueTree &) {
+    needsFullUpdate = true;
+    triggerAsyncUpdate();
+}
+
+void ValueTreeListModel::addChange(const Change &change) {
+    if (needsFullUpdate)
+        return;
+
+    if (changes.size() >= maxChangesPerBatch) {
+        needsFullUpdate = true;
+        changes.clearQuick();
+        changedChildren.clearQuick();
+    } else {
+        changes.add(change);
+    }
+
+    triggerAsyncUpdate();
+}
+
+//==============================================================================
+void ValueTreeListModel::handleAsyncUpdate() {
+    if (needsFullUpdate) {
+        updateAll();
+        return;
+    }
+
+    auto *list = listBox.getComponent();
+
+    // Each change is applied to the list's copy of the children as the list is told
+    // about it, so that the two always agree. Runs of children added or removed
+    // next to each other are passed on as one call.
+    for (int i = 0; i < changes.size();) {
+        const auto &change = changes.getReference(i);
+        int runLength = 1;
+
+        if (change.type == Change::Type::added) {
+            while (i + runLength < changes.size()
+                   && changes.getReference(i + runLength).type == Change::Type::added
+                   && changes.getReference(i + runLength).index == change.index + runLength)
+                ++runLength;
+
+            for (int j = 0; j < runLength; ++j)
+                children.insert(change.index + j, changes.getReference(i + j).child);
+
+            if (list != nullptr)
+                list->colsInserted(change.index, runLength);
+        } else if (change.type == Change::Type::removed) {
+            // removing the same index over and over takes out the children after it
+            while (i + runLength < changes.size()
+                   && changes.getReference(i + runLength).type == Change::Type::removed
+                   && changes.getReference(i + runLength).index == change.index)
+                ++runLength;
+
+            children.removeRange(change.index, runLength);
+
+            if (list != nullptr)
+                list->colsRemoved(change.index, runLength);
+        } else {
+            children.move(change.index, change.newIndex);
+
+            if (list != nullptr)
+                list->colMoved(change.index, change.newIndex);
+        }
+
+        i += runLength;
+    }
+
+    changes.clearQuick();
+
+    for (auto &child : changedChildren) {
+        const auto col = children.indexOf(child);
+
+        if (col >= 0 && list != nullptr)
+            list->colChanged(col);
+    }
+
+    changedChildren.clearQuick();
+}
+
+void ValueTreeListModel::updateAll() {
+    cancelPendingUpdate();
+    changes.clearQuick();
+    changedChildren.clearQuick();
+    needsFullUpdate = false;
+
+    children.clearQuick();
+
+    for (const auto &child : tree)
+        children.add(child);
+
+    if (listBox != nullptr)
+        listBox->allColsChanged();
+}
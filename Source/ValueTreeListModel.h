@@ -0,0 +1,102 @@
+/*
+  ==============================================================================
+
+    ValueTreeListModel.h
+    Created: 18 Oct 2026 7:36:43pm
+    Author:  Dmytro Kiro
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "HorizontalListBox.h"
+
+/**
+    A base class for models that show the children of a ValueTree as columns.
+
+    It listens to the tree and tells the list exactly what changed, rather than making
+    it update everything: an added, removed or moved child becomes a colsInserted(),
+    colsRemoved() or colMoved() call, which keeps the selection on the same items, and
+    a property change anywhere inside a child just refreshes that child's column with
+    colChanged(). The changes are collected and passed on together once the message
+    loop is free, so a burst of edits (e.g. an undo) only updates the list once. If a
+    lot of children change at once, the list is simply updated in full instead.
+
+    The list sees the children as they were after the last batch of changes, so
+    getChild() can be used from any of the model's callbacks on the message thread.
+    ValueTrees aren't thread-safe, so getTextForCol() isn't implemented here; a
+    subclass that wants to support searching has to keep its own copy of the text.
+
+    Subclasses paint the columns with paintListBoxItem().
+*/
+class ValueTreeListModel : public HorizontalListBoxModel,
+                           private ValueTree::Listener,
+                           private AsyncUpdater {
+public:
+    explicit ValueTreeListModel(const ValueTree &parentTree = {});
+
+    ~ValueTreeListModel() override;
+
+    /** Sets the list to tell about changes. The list should be using this as its model. */
+    void setListBox(HorizontalListBox *listToUpdate) noexcept { listBox = listToUpdate; }
+
+    //==============================================================================
+    /** Shows the children of a different tree, and updates the list. */
+    void setTree(const ValueTree &newParentTree);
+
+    /** Returns the tree whose children are being shown. */
+    const ValueTree &getTree() const noexcept { return tree; }
+
+    /** Returns the child shown in a column, or an invalid tree if it's out of range. */
+    ValueTree getChild(int col) const { return children[col]; }
+
+    /** Passes any changes that are waiting on to the list straight away. */
+    void flushChanges();
+
+    //==============================================================================
+    /** @internal */
+    int getNumRows() override { return children.size(); }
+
+private:
+    //==============================================================================
+    struct Change {
+        enum class Type { added, removed, moved };
+
+        Type type;
+        int index, newIndex;
+        ValueTree child;
+    };
+
+    // past this many changes in one batch, it's cheaper to update the whole list
+    static constexpr int maxChangesPerBatch = 64;
+
+    ValueTree tree;
+    Array<ValueTree> children;
+    Array<Change> changes;
+    Array<ValueTree> changedChildren;
+    Component::SafePointer<HorizontalListBox> listBox;
+    bool needsFullUpdate = false;
+
+    void valueTreePropertyChanged(ValueTree &treeWhosePropertyHasChanged, const Identifier &property) override;
+
+    void valueTreeChildAdded(ValueTree &parentTree, ValueTree &childWhichHasBeenAdded) override;
+
+    void valueTreeChildRemoved(ValueTree &parentTree, ValueTree &childWhichHasBeenRemoved,
+                               int indexFromWhichChildWasRemoved) override;
+
+    void valueTreeChildOrderChanged(ValueTree &parentTreeWhoseChildrenHaveMoved, int oldIndex, int newIndex) override;
+
+    void valueTreeParentChanged(ValueTree &treeWhoseParentHasChanged) override;
+
+    void valueTreeRedirected(ValueTree &treeWhichHasBeenChanged) override;
+
+    void handleAsyncUpdate() override;
+
+    void addChange(const Change &change);
+
+    void updateAll();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ValueTreeListModel)
+};